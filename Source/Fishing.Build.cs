@@ -18,7 +18,9 @@ public class Fishing : ModuleRules
 			"GameplayStateTreeModule",
 			"UMG",
 			"Niagara",
-			"Water"
+			"Water",
+			"SQLiteCore",
+			"DeveloperSettings"
 			
 		});
 
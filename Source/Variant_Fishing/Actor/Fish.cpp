@@ -1,12 +1,13 @@
 #include "Fish.h"
 #include "Variant_Fishing/Data/FishData.h"
 #include "FishSpawnPool.h"
+#include "FishSimulation.h"
 #include "Variant_Fishing/ActorComponent/FishingFeatures/FishingComponent.h"
 #include "FishingCharacter.h"
+#include "Variant_Fishing/Subsystem/BobberRegistrySubsystem.h"
 
 #include "Components/StaticMeshComponent.h"
 #include "Net/UnrealNetwork.h"
-#include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
 DEFINE_LOG_CATEGORY(LogFish);
@@ -73,7 +74,7 @@ static void SetMeshPivotToEnd(UStaticMeshComponent* MeshComp, EAxis::Type Axis,
 
 AFish::AFish()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	Pivot = CreateDefaultSubobject<USceneComponent>(TEXT("Pivot"));
 	RootComponent = Pivot;
@@ -99,14 +100,8 @@ AFish::AFish()
 	TailMarker->SetupAttachment(Pivot);
 
 	BehaviorState = EFishBehaviorState::Wandering;
-	MovementState = EFishMovementState::Idle;
 	TargetBobber = nullptr;
 	bIsActive = false;
-	bNeedsNewTarget = false;
-	IdleTimer = 0.f;
-	IdleDuration = 0.f;
-	MovementTimer = 0.f;
-	TotalMovementTime = 0.f;
 	FakeBitePhase = EFakeBitePhase::None;
 	FakeBiteTimer = 0.f;
 }
@@ -152,7 +147,6 @@ void AFish::Initialize(UFishData* InFishData, AFishSpawnPool* InSpawnPool, const
 
 	bIsActive = true;
 	SetActorHiddenInGame(false);
-	SetActorTickEnabled(true);
 
 	UE_LOG(LogFish, Log, TEXT("Fish initialized: %s"), FishData ? *FishData->FishID.ToString() : TEXT("Unknown"));
 }
@@ -180,7 +174,6 @@ void AFish::Activate(UFishData* InFishData, const FVector& SpawnLocation)
 
 	bIsActive = true;
 	SetActorHiddenInGame(false);
-	SetActorTickEnabled(true);
 
 	UE_LOG(LogFish, Log, TEXT("Fish reactivated: %s"), FishData ? *FishData->FishID.ToString() : TEXT("Unknown"));
 }
@@ -196,7 +189,6 @@ void AFish::Deactivate()
 	ResetInternalState();
 
 	SetActorHiddenInGame(true);
-	SetActorTickEnabled(false);
 	SetActorLocation(FVector(0.f, 0.f, -10000.f));
 
 	UE_LOG(LogFish, Log, TEXT("Fish deactivated"));
@@ -204,162 +196,72 @@ void AFish::Deactivate()
 
 void AFish::ResetInternalState()
 {
-	BehaviorState = EFishBehaviorState::Wandering;
-	MovementState = EFishMovementState::Idle;
+	SetBehaviorState(EFishBehaviorState::Wandering);
 	TargetBobber = nullptr;
-	bNeedsNewTarget = false;
-	IdleTimer = 0.f;
-	IdleDuration = FMath::FRandRange(MinIdleTime, MaxIdleTime);
-	CurrentTarget = GetActorLocation();
-	MovementStartLocation = GetActorLocation();
-	MovementTimer = 0.f;
-	TotalMovementTime = 0.f;
-	TotalMovementDistance = 0.f;
 	FakeBitePhase = EFakeBitePhase::None;
 	FakeBiteTimer = 0.f;
+
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->EnterIdle(SimulationIndex, Simulation->GetRandomIdleDuration(SimulationIndex));
+	}
 }
 
-void AFish::Tick(float DeltaTime)
+void AFish::TickBehavior(float DeltaTime, float SimDeltaTime)
 {
-	Super::Tick(DeltaTime);
-
-	if (!bIsActive)
+	FFishSimulation* Simulation = GetSimulation();
+	if (!bIsActive || !Simulation)
 	{
 		return;
 	}
 
-	if (HasAuthority() &&
-		((BehaviorState == EFishBehaviorState::FakeBiting
-				|| BehaviorState == EFishBehaviorState::Biting
-				|| BehaviorState == EFishBehaviorState::MovingToBobber)
-			&& (TargetBobber == nullptr)))
+	if ((BehaviorState == EFishBehaviorState::FakeBiting
+			|| BehaviorState == EFishBehaviorState::Biting
+			|| BehaviorState == EFishBehaviorState::MovingToBobber)
+		&& (TargetBobber == nullptr))
 	{
 		SetStateVanishing();
 	}
 
-	if (BehaviorState == EFishBehaviorState::Vanishing)
+	switch (BehaviorState)
 	{
+	case EFishBehaviorState::Vanishing:
 		TickVanishing(DeltaTime);
-	}
-	else if (BehaviorState == EFishBehaviorState::FakeBiting)
-	{
-		TickFakeBite(DeltaTime);
-	}
-	else
-	{
-		TickMovement(DeltaTime);
-	}
-
-	if (BehaviorState == EFishBehaviorState::FakeBiting)
-	{
-		TickFakeBite(DeltaTime);
-	}
-	else
-	{
-		if (BehaviorState == EFishBehaviorState::MovingToBobber && TargetBobber && TargetBobber->IsVisible())
-		{
-			FVector BobberLoc = TargetBobber->GetComponentLocation();
-			CurrentTarget = BobberLoc;
+		break;
 
-			if (MovementState == EFishMovementState::Rotating)
-			{
-				FVector Direction = BobberLoc - GetActorLocation();
-				Direction.Z = 0.f;
-				Direction.Normalize();
-				TargetRotation = Direction.Rotation();
-			}
+	case EFishBehaviorState::FakeBiting:
+		TickFakeBite(SimDeltaTime);
+		break;
 
-			if (MovementState == EFishMovementState::Moving)
-			{
-				float NewDistance = FVector::Dist2D(GetActorLocation(), CurrentTarget);
-				float BaseSpeed = GetCurrentMoveSpeed();
-				if (BaseSpeed > 0.f)
-				{
-					TotalMovementTime = NewDistance / BaseSpeed;
-				}
-			}
+	case EFishBehaviorState::MovingToBobber:
+		if (TargetBobber->IsVisible())
+		{
+			Simulation->Retarget(SimulationIndex, TargetBobber->GetComponentLocation());
+		}
+		if (Simulation->StepMovement(SimulationIndex, SimDeltaTime))
+		{
+			OnReachedTarget();
 		}
-
-		TickMovement(DeltaTime);
-	}
-
-	if (bShowDebugMovement)
-	{
-		DrawMovementDebug();
-	}
-}
-
-void AFish::TickMovement(float DeltaTime)
-{
-	switch (MovementState)
-	{
-	case EFishMovementState::Idle:
-		TickIdle(DeltaTime);
-		break;
-	case EFishMovementState::Rotating:
-		TickRotating(DeltaTime);
-		break;
-	case EFishMovementState::Moving:
-		TickMoving(DeltaTime);
 		break;
-	}
-}
 
-void AFish::TickIdle(float DeltaTime)
-{
-	IdleTimer += DeltaTime;
-
-	if (IdleTimer >= IdleDuration)
-	{
-		if (BehaviorState == EFishBehaviorState::Wandering)
+	default:
+		if (Simulation->StepMovement(SimulationIndex, SimDeltaTime))
 		{
-			bNeedsNewTarget = true;
-			UE_LOG(LogFish, Verbose, TEXT("Idle finished, requesting new target"));
+			OnReachedTarget();
 		}
+		break;
 	}
 }
 
-void AFish::TickRotating(float DeltaTime)
-{
-	FRotator CurrentRot = GetActorRotation();
-	FRotator NewRot = FMath::RInterpTo(CurrentRot, TargetRotation, DeltaTime, RotationSpeed);
-	SetActorRotation(NewRot);
-
-	const float AngleDiff = FMath::Abs(FMath::FindDeltaAngleDegrees(NewRot.Yaw, TargetRotation.Yaw));
-	if (AngleDiff < 5.0f)
-	{
-		SetActorRotation(TargetRotation);
-		StartMovingToTarget();
-	}
-}
-
-void AFish::TickMoving(float DeltaTime)
+void AFish::TickFakeBite(float DeltaTime)
 {
-	FVector CurrentLoc = GetActorLocation();
-	FVector Direction = CurrentTarget - CurrentLoc;
-	Direction.Z = 0.f;
-
-	const float Distance = Direction.Size2D();
-	if (Distance < ArrivalThreshold)
+	FFishSimulation* Simulation = GetSimulation();
+	if (!Simulation)
 	{
-		OnReachedTarget();
 		return;
 	}
 
-	MovementTimer += DeltaTime;
-
-	const float SpeedMultiplier = CalculateSpeedMultiplier();
-	Direction.Normalize();
-	const float MoveSpeed = GetCurrentMoveSpeed() * SpeedMultiplier;
-
-	FVector NewLocation = CurrentLoc + Direction * MoveSpeed * DeltaTime;
-	NewLocation.Z = InitialSpawnLocation.Z;
-
-	SetActorLocation(NewLocation);
-}
-
-void AFish::TickFakeBite(float DeltaTime)
-{
 	switch (FakeBitePhase)
 	{
 	case EFakeBitePhase::Freeze:
@@ -373,14 +275,12 @@ void AFish::TickFakeBite(float DeltaTime)
 		}
 
 	case EFakeBitePhase::BackOff:
-		{
-			TickMoving(DeltaTime);
-			break;
-		}
-
 	case EFakeBitePhase::Return:
 		{
-			TickMoving(DeltaTime);
+			if (Simulation->StepMoving(SimulationIndex, DeltaTime))
+			{
+				OnReachedTarget();
+			}
 			break;
 		}
 
@@ -389,80 +289,100 @@ void AFish::TickFakeBite(float DeltaTime)
 	}
 }
 
-float AFish::CalculateSpeedMultiplier() const
+FFishSimulation* AFish::GetSimulation() const
 {
-	if (TotalMovementTime <= 0.f)
+	if (!SpawnPool || SimulationIndex == INDEX_NONE)
 	{
-		return 1.0f;
+		return nullptr;
 	}
+	return &SpawnPool->GetSimulation();
+}
 
-	const float Progress = FMath::Clamp(MovementTimer / TotalMovementTime, 0.f, 1.f);
-	float SpeedMultiplier = 1.0f;
+FVector AFish::GetSimulatedLocation() const
+{
+	const FFishSimulation* Simulation = GetSimulation();
+	return Simulation ? Simulation->Locations[SimulationIndex] : GetActorLocation();
+}
 
-	const float AccelPhaseEnd = AccelerationTime / TotalMovementTime;
-	const float DecelPhaseStart = 1.0f - (DecelerationTime / TotalMovementTime);
+FVector AFish::GetSimulatedForward() const
+{
+	const FFishSimulation* Simulation = GetSimulation();
+	return Simulation ? FRotator(0.f, Simulation->Yaws[SimulationIndex], 0.f).Vector() : GetActorForwardVector();
+}
 
-	if (AccelPhaseEnd >= DecelPhaseStart)
+void AFish::SetBehaviorState(EFishBehaviorState NewState)
+{
+	BehaviorState = NewState;
+
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
 	{
-		if (Progress < 0.5f)
-		{
-			const float LocalProgress = Progress * 2.0f;
-			SpeedMultiplier = FMath::InterpEaseIn(MinSpeedMultiplier, 1.0f, LocalProgress, 2.0f);
-		}
-		else
-		{
-			const float LocalProgress = (Progress - 0.5f) * 2.0f;
-			SpeedMultiplier = FMath::InterpEaseOut(1.0f, MinSpeedMultiplier, LocalProgress, 2.0f);
-		}
+		Simulation->SetBehavior(SimulationIndex, NewState, GetCurrentMoveSpeed());
 	}
-	else
+}
+
+FTransform AFish::GetMeshRelativeTransform() const
+{
+	return FishMesh ? FishMesh->GetRelativeTransform() : FTransform::Identity;
+}
+
+UStaticMesh* AFish::GetFishStaticMesh() const
+{
+	return FishMesh ? FishMesh->GetStaticMesh() : nullptr;
+}
+
+void AFish::SetRenderedAsInstance(bool bInstanced)
+{
+	if (FishMesh)
 	{
-		if (Progress < AccelPhaseEnd)
-		{
-			const float LocalProgress = Progress / AccelPhaseEnd;
-			SpeedMultiplier = FMath::InterpEaseIn(MinSpeedMultiplier, 1.0f, LocalProgress, 2.0f);
-		}
-		else if (Progress > DecelPhaseStart)
-		{
-			const float LocalProgress = (Progress - DecelPhaseStart) / (1.0f - DecelPhaseStart);
-			SpeedMultiplier = FMath::InterpEaseOut(1.0f, MinSpeedMultiplier, LocalProgress, 2.0f);
-		}
-		else
-		{
-			const float WaveProgress = (Progress - AccelPhaseEnd) / (DecelPhaseStart - AccelPhaseEnd);
-			const float Wave = FMath::Sin(WaveProgress * PI * 2.0f) * SpeedVariation;
-			SpeedMultiplier = 1.0f + Wave;
-		}
+		FishMesh->SetVisibility(!bInstanced);
 	}
-
-	return FMath::Clamp(SpeedMultiplier, MinSpeedMultiplier, 1.0f + SpeedVariation);
 }
 
-void AFish::StartRotatingToTarget(const FVector& TargetLocation)
+EFishMovementState AFish::GetMovementState() const
 {
-	MovementState = EFishMovementState::Rotating;
-	CurrentTarget = TargetLocation;
+	const FFishSimulation* Simulation = GetSimulation();
+	return Simulation ? Simulation->MovementStates[SimulationIndex] : EFishMovementState::Idle;
+}
 
-	FVector Direction = TargetLocation - GetActorLocation();
-	Direction.Z = 0.f;
-	Direction.Normalize();
+bool AFish::NeedsNewWanderTarget() const
+{
+	const FFishSimulation* Simulation = GetSimulation();
+	return Simulation && Simulation->NeedsNewTarget[SimulationIndex] && !IsIdling();
+}
 
-	TargetRotation = Direction.Rotation();
-	UE_LOG(LogFish, Verbose, TEXT("Fish starting rotation to target"));
+bool AFish::IsIdling() const
+{
+	const FFishSimulation* Simulation = GetSimulation();
+	return Simulation
+		&& Simulation->MovementStates[SimulationIndex] == EFishMovementState::Idle
+		&& Simulation->IdleTimers[SimulationIndex] < Simulation->IdleDurations[SimulationIndex];
 }
 
-void AFish::StartMovingToTarget()
+FFishMovementProfile AFish::GetMovementProfile() const
 {
-	MovementState = EFishMovementState::Moving;
-	MovementStartLocation = GetActorLocation();
-	MovementTimer = 0.f;
+	FFishMovementProfile Profile;
+	Profile.RotationSpeed = RotationSpeed;
+	Profile.ArrivalThreshold = ArrivalThreshold;
+	Profile.MinIdleTime = MinIdleTime;
+	Profile.MaxIdleTime = MaxIdleTime;
+	Profile.AccelerationTime = AccelerationTime;
+	Profile.DecelerationTime = DecelerationTime;
+	Profile.MinSpeedMultiplier = MinSpeedMultiplier;
+	Profile.SpeedVariation = SpeedVariation;
+	return Profile;
+}
 
-	TotalMovementDistance = FVector::Dist2D(MovementStartLocation, CurrentTarget);
-	const float BaseSpeed = GetCurrentMoveSpeed();
-	TotalMovementTime = (BaseSpeed > 0.f) ? (TotalMovementDistance / BaseSpeed) : 1.0f;
+void AFish::StartRotatingToTarget(const FVector& TargetLocation)
+{
+	FFishSimulation* Simulation = GetSimulation();
+	if (!Simulation)
+	{
+		return;
+	}
 
-	UE_LOG(LogFish, Verbose, TEXT("Fish started moving to target (Distance: %.1f, Time: %.1fs)"),
-	       TotalMovementDistance, TotalMovementTime);
+	Simulation->StartRotating(SimulationIndex, TargetLocation);
+	UE_LOG(LogFish, Verbose, TEXT("Fish starting rotation to target"));
 }
 
 void AFish::OnReachedTarget()
@@ -473,14 +393,15 @@ void AFish::OnReachedTarget()
 		return;
 	}
 
-	MovementState = EFishMovementState::Idle;
-	IdleTimer = 0.f;
-	IdleDuration = FMath::FRandRange(MinIdleTime, MaxIdleTime);
-	bNeedsNewTarget = false;
-	MovementTimer = 0.f;
-	TotalMovementTime = 0.f;
+	FFishSimulation* Simulation = GetSimulation();
+	if (!Simulation)
+	{
+		return;
+	}
 
-	UE_LOG(LogFish, Verbose, TEXT("Fish reached target, idling for %.1fs"), IdleDuration);
+	Simulation->EnterIdle(SimulationIndex, Simulation->GetRandomIdleDuration(SimulationIndex));
+
+	UE_LOG(LogFish, Verbose, TEXT("Fish reached target, idling for %.1fs"), Simulation->IdleDurations[SimulationIndex]);
 }
 
 void AFish::RequestNewWanderTarget()
@@ -504,7 +425,11 @@ float AFish::GetCurrentMoveSpeed() const
 
 void AFish::SetWanderTarget(const FVector& TargetLocation)
 {
-	bNeedsNewTarget = false;
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->NeedsNewTarget[SimulationIndex] = false;
+	}
 	StartRotatingToTarget(TargetLocation);
 }
 
@@ -517,42 +442,27 @@ UStaticMeshComponent* AFish::DetectBobberInView()
 
 	UStaticMeshComponent* DetectedBobber = nullptr;
 
-	TArray<AActor*> Characters;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AFishingCharacter::StaticClass(), Characters);
-
-	for (AActor* Actor : Characters)
+	UBobberRegistrySubsystem* Registry = UBobberRegistrySubsystem::Get(GetWorld());
+	if (Registry)
 	{
-		AFishingCharacter* FishChar = Cast<AFishingCharacter>(Actor);
-		if (!FishChar || !FishChar->CoreFishingComponent)
-		{
-			continue;
-		}
-		if (!FishChar->CoreFishingComponent->IsFishing())
-		{
-			continue;
-		}
+		const FVector FishLoc = GetSimulatedLocation();
+		const FVector Forward = GetSimulatedForward();
+		const float RangeSq = FMath::Square(FishData->BobberDetectionRange);
 
-		UStaticMeshComponent* Bobber = FishChar->CoreFishingComponent->GetBobber();
-		if (!Bobber || !Bobber->IsVisible())
+		for (const FActiveBobber& Active : Registry->GetActiveBobbers())
 		{
-			continue;
-		}
-
-		const FVector BobberLoc = Bobber->GetComponentLocation();
-		const float Distance = FVector::Dist2D(GetActorLocation(), BobberLoc);
-		if (Distance > FishData->BobberDetectionRange)
-		{
-			continue;
-		}
-
-		FVector ToTarget = BobberLoc - GetActorLocation();
-		ToTarget.Normalize();
+			if (FVector::DistSquared2D(FishLoc, Active.Location) > RangeSq)
+			{
+				continue;
+			}
 
-		const float DotProduct = FVector::DotProduct(GetActorForwardVector(), ToTarget);
-		if (DotProduct > FishData->DetectionViewAngle)
-		{
-			DetectedBobber = Bobber;
-			break;
+			const FVector ToTarget = (Active.Location - FishLoc).GetSafeNormal();
+			const float DotProduct = FVector::DotProduct(Forward, ToTarget);
+			if (DotProduct > FishData->DetectionViewAngle)
+			{
+				DetectedBobber = Active.Bobber;
+				break;
+			}
 		}
 	}
 
@@ -572,7 +482,7 @@ void AFish::StartMovingToBobber(UStaticMeshComponent* InTargetBobber)
 	}
 
 	TargetBobber = InTargetBobber;
-	BehaviorState = EFishBehaviorState::MovingToBobber;
+	SetBehaviorState(EFishBehaviorState::MovingToBobber);
 
 	const FVector BobberLoc = TargetBobber->GetComponentLocation();
 	StartRotatingToTarget(BobberLoc);
@@ -586,7 +496,7 @@ bool AFish::IsWithinBiteRange(const FVector& BobberLocation) const
 	{
 		return false;
 	}
-	const float Distance = FVector::Dist2D(GetActorLocation(), BobberLocation);
+	const float Distance = FVector::Dist2D(GetSimulatedLocation(), BobberLocation);
 	return Distance < 20.f;
 }
 
@@ -597,13 +507,14 @@ void AFish::SetStateWandering()
 		return;
 	}
 
-	BehaviorState = EFishBehaviorState::Wandering;
+	SetBehaviorState(EFishBehaviorState::Wandering);
 	TargetBobber = nullptr;
 
-	MovementState = EFishMovementState::Idle;
-	IdleTimer = 0.f;
-	IdleDuration = FMath::FRandRange(MinIdleTime * 0.5f, MaxIdleTime * 0.5f);
-	bNeedsNewTarget = false;
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->EnterIdle(SimulationIndex, Simulation->GetRandomIdleDuration(SimulationIndex, 0.5f));
+	}
 
 	FakeBitePhase = EFakeBitePhase::None;
 	FakeBiteTimer = 0.f;
@@ -616,8 +527,13 @@ void AFish::SetStateBiting()
 		return;
 	}
 
-	BehaviorState = EFishBehaviorState::Biting;
-	MovementState = EFishMovementState::Idle;
+	SetBehaviorState(EFishBehaviorState::Biting);
+
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->Stop(SimulationIndex);
+	}
 	FakeBitePhase = EFakeBitePhase::None;
 	FakeBiteTimer = 0.f;
 
@@ -646,7 +562,7 @@ void AFish::SetStateFakeBiting()
 
 	if (CurrentFakeBiteCount >= 0)
 	{
-		BehaviorState = EFishBehaviorState::FakeBiting;
+		SetBehaviorState(EFishBehaviorState::FakeBiting);
 		StartFakeBiteFreeze();
 
 		if (TargetBobber)
@@ -669,10 +585,19 @@ void AFish::TickVanishing(float DeltaTime)
 {
 	VanishingTimer += DeltaTime;
 
-	const FVector BackDir = (GetActorForwardVector()).GetSafeNormal2D();
-	FVector NewLoc = GetActorLocation() + BackDir * VanishSpeed * DeltaTime;
+	const FVector BackDir = GetSimulatedForward().GetSafeNormal2D();
+	FVector NewLoc = GetSimulatedLocation() + BackDir * VanishSpeed * DeltaTime;
 	NewLoc.Z = InitialSpawnLocation.Z;
-	SetActorLocation(NewLoc, false);
+
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->SetLocation(SimulationIndex, NewLoc);
+	}
+	else
+	{
+		SetActorLocation(NewLoc, false);
+	}
 
 	if (VanishingTimer >= VanishingTime)
 	{
@@ -694,13 +619,20 @@ void AFish::SetStateVanishing()
 		return;
 	}
 
-	BehaviorState = EFishBehaviorState::Vanishing;
-	MovementState = EFishMovementState::Moving;
+	SetBehaviorState(EFishBehaviorState::Vanishing);
 	TargetBobber = nullptr;
 
-	const FVector BackDir = (-GetActorForwardVector()).GetSafeNormal2D();
-	const FRotator BackRot = BackDir.Rotation();
-	SetActorRotation(BackRot);
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->Stop(SimulationIndex);
+		Simulation->SetYaw(SimulationIndex, Simulation->Yaws[SimulationIndex] + 180.f);
+	}
+	else
+	{
+		const FVector BackDir = (-GetActorForwardVector()).GetSafeNormal2D();
+		SetActorRotation(BackDir.Rotation());
+	}
 
 	VanishingTimer = 0.f;
 
@@ -719,7 +651,12 @@ void AFish::StartFakeBiteFreeze()
 {
 	FakeBitePhase = EFakeBitePhase::Freeze;
 	FakeBiteTimer = 0.f;
-	MovementState = EFishMovementState::Idle;
+
+	FFishSimulation* Simulation = GetSimulation();
+	if (Simulation)
+	{
+		Simulation->Stop(SimulationIndex);
+	}
 
 	UE_LOG(LogFish, Verbose, TEXT("FakeBite: Freeze phase started"));
 }
@@ -728,21 +665,18 @@ void AFish::StartFakeBiteBackOff()
 {
 	FakeBitePhase = EFakeBitePhase::BackOff;
 
-	const FVector BackOffDirection = -GetActorForwardVector();
-	FVector BackOffTarget = GetActorLocation() + BackOffDirection * BackOffDistance;
-	BackOffTarget.Z = InitialSpawnLocation.Z;
-
-	if (SpawnPool)
+	FFishSimulation* Simulation = GetSimulation();
+	if (!Simulation)
 	{
-		BackOffTarget = SpawnPool->ClampLocationToBounds(BackOffTarget);
+		return;
 	}
 
-	MovementState = EFishMovementState::Moving;
-	CurrentTarget = BackOffTarget;
-	MovementStartLocation = GetActorLocation();
-	MovementTimer = 0.f;
-	TotalMovementDistance = FVector::Dist2D(MovementStartLocation, CurrentTarget);
-	TotalMovementTime = 0.3f;
+	const FVector BackOffDirection = -GetSimulatedForward();
+	FVector BackOffTarget = GetSimulatedLocation() + BackOffDirection * BackOffDistance;
+	BackOffTarget.Z = InitialSpawnLocation.Z;
+	BackOffTarget = SpawnPool->ClampLocationToBounds(BackOffTarget);
+
+	Simulation->StartTimedMove(SimulationIndex, BackOffTarget, 0.3f);
 
 	UE_LOG(LogFish, Verbose, TEXT("FakeBite: BackOff phase started"));
 }
@@ -790,21 +724,18 @@ void AFish::PlayBackOff()
 		return;
 	}
 
-	const FVector BackOffDirection = -GetActorForwardVector();
-	FVector BackOffTarget = GetActorLocation() + BackOffDirection * BackOffDistance;
-	BackOffTarget.Z = InitialSpawnLocation.Z;
-
-	if (SpawnPool)
+	FFishSimulation* Simulation = GetSimulation();
+	if (!Simulation)
 	{
-		BackOffTarget = SpawnPool->ClampLocationToBounds(BackOffTarget);
+		return;
 	}
 
-	MovementState = EFishMovementState::Moving;
-	CurrentTarget = BackOffTarget;
-	MovementStartLocation = GetActorLocation();
-	MovementTimer = 0.f;
-	TotalMovementDistance = FVector::Dist2D(MovementStartLocation, CurrentTarget);
-	TotalMovementTime = 0.3f;
+	const FVector BackOffDirection = -GetSimulatedForward();
+	FVector BackOffTarget = GetSimulatedLocation() + BackOffDirection * BackOffDistance;
+	BackOffTarget.Z = InitialSpawnLocation.Z;
+	BackOffTarget = SpawnPool->ClampLocationToBounds(BackOffTarget);
+
+	Simulation->StartTimedMove(SimulationIndex, BackOffTarget, 0.3f);
 
 	UE_LOG(LogFish, Verbose, TEXT("Fish backing off during bite struggle"));
 }
@@ -860,12 +791,21 @@ void AFish::DrawDetectionDebug(UStaticMeshComponent* DetectedBobber)
 
 void AFish::DrawMovementDebug()
 {
-	if (!GetWorld())
+	const FFishSimulation* Simulation = GetSimulation();
+	if (!GetWorld() || !Simulation)
 	{
 		return;
 	}
 
-	const FVector FishLoc = GetActorLocation();
+	const int32 Index = SimulationIndex;
+	const EFishMovementState MovementState = Simulation->MovementStates[Index];
+	const FVector& CurrentTarget = Simulation->Targets[Index];
+	const FVector& MovementStartLocation = Simulation->MovementStartLocations[Index];
+	const float MovementTimer = Simulation->MovementTimers[Index];
+	const float TotalMovementTime = Simulation->MovementDurations[Index];
+	const float TotalMovementDistance = FVector::Dist2D(MovementStartLocation, CurrentTarget);
+
+	const FVector FishLoc = GetSimulatedLocation();
 	FColor StateColor;
 	FString StateText;
 
@@ -904,14 +844,15 @@ void AFish::DrawMovementDebug()
 		{
 		case EFishMovementState::Idle:
 			StateColor = FColor::Yellow;
-			StateText = FString::Printf(TEXT("Idle (%.1fs/%.1fs)"), IdleTimer, IdleDuration);
+			StateText = FString::Printf(TEXT("Idle (%.1fs/%.1fs)"), Simulation->IdleTimers[Index],
+			                            Simulation->IdleDurations[Index]);
 			break;
 
 		case EFishMovementState::Rotating:
 			StateColor = FColor::Orange;
 			StateText = TEXT("Rotating");
 			DrawDebugDirectionalArrow(GetWorld(), FishLoc,
-			                          FishLoc + TargetRotation.Vector() * 50.f,
+			                          FishLoc + FRotator(0.f, Simulation->TargetYaws[Index], 0.f).Vector() * 50.f,
 			                          20.f, FColor::Orange, false, -1.f, 0, 2.0f);
 			break;
 
@@ -919,7 +860,7 @@ void AFish::DrawMovementDebug()
 			{
 				StateColor = FColor::Green;
 
-				const float SpeedMultiplier = CalculateSpeedMultiplier();
+				const float SpeedMultiplier = Simulation->GetSpeedMultiplier(Index);
 				const float Progress = TotalMovementTime > 0.f ? (MovementTimer / TotalMovementTime) * 100.f : 0.f;
 
 				FString SpeedPhase = TEXT("Cruise");
@@ -980,7 +921,7 @@ void AFish::DrawMovementDebug()
 
 	
 	DrawDebugDirectionalArrow(GetWorld(), FishLoc,
-	                          FishLoc + GetActorForwardVector() * 30.f,
+	                          FishLoc + GetSimulatedForward() * 30.f,
 	                          15.f, FColor::Blue, false, .01f, 0, 1.5f);
 
 	
@@ -1007,7 +948,7 @@ void AFish::DrawMovementDebug()
 		}
 	}
 
-	if (bNeedsNewTarget && MovementState == EFishMovementState::Idle)
+	if (Simulation->NeedsNewTarget[Index] && MovementState == EFishMovementState::Idle)
 	{
 		DrawDebugString(GetWorld(), FishLoc + FVector(0, 0, 90.f),
 		                TEXT("Needs Target!"), nullptr, FColor::Red, .01f, true, 1.0f);
@@ -1111,5 +1052,4 @@ void AFish::OnRep_IsActive()
 {
 	const bool bActive = bIsActive;
 	SetActorHiddenInGame(!bActive);
-	SetActorTickEnabled(bActive);
 }
\ No newline at end of file
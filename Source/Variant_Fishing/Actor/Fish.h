@@ -9,6 +9,8 @@ DECLARE_LOG_CATEGORY_EXTERN(LogFish, Log, All);
 class UFishData;
 class UStaticMeshComponent;
 class AFishSpawnPool;
+class FFishSimulation;
+struct FFishMovementProfile;
 
 UENUM(BlueprintType)
 enum class EFishMovementState : uint8
@@ -44,7 +46,6 @@ class FISHING_API AFish : public AActor
 public:
 	AFish();
 
-	virtual void Tick(float DeltaTime) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	void Initialize(UFishData* InFishData, AFishSpawnPool* InSpawnPool, const FVector& SpawnLocation);
@@ -58,11 +59,12 @@ public:
 	EFishBehaviorState GetBehaviorState() const { return BehaviorState; }
 
 	UFUNCTION(BlueprintCallable, Category="Fish")
-	EFishMovementState GetMovementState() const { return MovementState; }
+	EFishMovementState GetMovementState() const;
 
 	UFUNCTION(BlueprintCallable, Category="Fish")
 	UFishData* GetFishData() const { return FishData; }
 
+	void TickBehavior(float DeltaTime, float SimDeltaTime);
 	void SetWanderTarget(const FVector& TargetLocation);
 	UStaticMeshComponent* DetectBobberInView();
 	void StartMovingToBobber(UStaticMeshComponent* InTargetBobber);
@@ -94,8 +96,20 @@ public:
 	USceneComponent* TailMarker; 
 
 	UStaticMeshComponent* GetTargetBobber() const { return TargetBobber; }
-	bool NeedsNewWanderTarget() const { return bNeedsNewTarget && !IsIdling(); }
-	bool IsIdling() const { return MovementState == EFishMovementState::Idle && IdleTimer < IdleDuration; }
+	bool NeedsNewWanderTarget() const;
+	bool IsIdling() const;
+
+	int32 GetSimulationIndex() const { return SimulationIndex; }
+	void SetSimulationIndex(int32 InIndex) { SimulationIndex = InIndex; }
+	FFishMovementProfile GetMovementProfile() const;
+	float GetCurrentMoveSpeed() const;
+	bool IsMovementDebugEnabled() const { return bShowDebugMovement; }
+
+	FVector GetSimulatedLocation() const;
+	FVector GetSimulatedForward() const;
+	FTransform GetMeshRelativeTransform() const;
+	UStaticMesh* GetFishStaticMesh() const;
+	void SetRenderedAsInstance(bool bInstanced);
 
 protected:
 	virtual void BeginPlay() override;
@@ -122,29 +136,16 @@ protected:
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="Fish")
 	EFishBehaviorState BehaviorState = EFishBehaviorState::Wandering;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Fish")
-	EFishMovementState MovementState = EFishMovementState::Idle;
-
 	UPROPERTY(VisibleAnywhere, Category="Fish")
 	USceneComponent* Pivot;
 
-	FVector CurrentTarget = FVector::ZeroVector;
 	FVector InitialSpawnLocation = FVector::ZeroVector;
-	FVector MovementStartLocation = FVector::ZeroVector;
-	FRotator TargetRotation = FRotator::ZeroRotator;
-
-	float IdleTimer = 0.f;
-	float IdleDuration = 0.f;
 
 	float VanishingTime = 0.8f;
 	float VanishSpeed = 250.f;
 	float VanishingTimer = 0.f;
 
-	float MovementTimer = 0.f;
-	float TotalMovementTime = 0.f;
-	float TotalMovementDistance = 0.f;
-
-	bool bNeedsNewTarget = false;
+	int32 SimulationIndex = INDEX_NONE;
 
 	UPROPERTY()
 	UStaticMeshComponent* TargetBobber = nullptr;
@@ -183,22 +184,18 @@ protected:
 	bool bShowDebugMovement = true;
 	bool bRemovedFromPoolOnVanishing;
 
-	void TickMovement(float DeltaTime);
-	void TickIdle(float DeltaTime);
-	void TickRotating(float DeltaTime);
-	void TickMoving(float DeltaTime);
 	void TickFakeBite(float DeltaTime);
 
+	FFishSimulation* GetSimulation() const;
+	void SetBehaviorState(EFishBehaviorState NewState);
+
 	void StartRotatingToTarget(const FVector& TargetLocation);
-	void StartMovingToTarget();
 	void OnReachedTarget();
 	void RequestNewWanderTarget();
 
 	void StartFakeBiteFreeze();
 	void StartFakeBiteBackOff();
 
-	float GetCurrentMoveSpeed() const;
-	float CalculateSpeedMultiplier() const;
 	void ResetInternalState();
 
 	UPROPERTY(ReplicatedUsing=OnRep_FishData, VisibleAnywhere, BlueprintReadOnly)
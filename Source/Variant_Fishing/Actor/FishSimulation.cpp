@@ -0,0 +1,327 @@
+#include "FishSimulation.h"
+
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Async/ParallelFor.h"
+
+int32 FFishSimulation::Add(AFish* InFish, int32 Seed)
+{
+	if (!InFish || InFish->GetSimulationIndex() != INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	const FVector Location = InFish->GetActorLocation();
+	const float Yaw = InFish->GetActorRotation().Yaw;
+
+	const int32 Index = Fish.Add(InFish);
+	Behaviors.Add(InFish->GetBehaviorState());
+	MovementStates.Add(EFishMovementState::Idle);
+	Locations.Add(Location);
+	Yaws.Add(Yaw);
+	TargetYaws.Add(Yaw);
+	Targets.Add(Location);
+	MovementStartLocations.Add(Location);
+	IdleTimers.Add(0.f);
+	IdleDurations.Add(0.f);
+	MovementTimers.Add(0.f);
+	MovementDurations.Add(0.f);
+	MoveSpeeds.Add(InFish->GetCurrentMoveSpeed());
+	SwimHeights.Add(Location.Z);
+	Profiles.Add(InFish->GetMovementProfile());
+	RandomStreams.Add(FRandomStream(Seed));
+	NeedsNewTarget.Add(false);
+	TransformDirty.Add(false);
+	MeshTransforms.Add(InFish->GetMeshRelativeTransform());
+	InstanceComponents.Add(nullptr);
+	InstanceIndices.Add(INDEX_NONE);
+
+	InFish->SetSimulationIndex(Index);
+	EnterIdle(Index, GetRandomIdleDuration(Index));
+	return Index;
+}
+
+void FFishSimulation::Remove(AFish* InFish)
+{
+	const int32 Index = InFish ? InFish->GetSimulationIndex() : INDEX_NONE;
+	if (!Fish.IsValidIndex(Index) || Fish[Index] != InFish)
+	{
+		return;
+	}
+
+	Fish.RemoveAtSwap(Index);
+	Behaviors.RemoveAtSwap(Index);
+	MovementStates.RemoveAtSwap(Index);
+	Locations.RemoveAtSwap(Index);
+	Yaws.RemoveAtSwap(Index);
+	TargetYaws.RemoveAtSwap(Index);
+	Targets.RemoveAtSwap(Index);
+	MovementStartLocations.RemoveAtSwap(Index);
+	IdleTimers.RemoveAtSwap(Index);
+	IdleDurations.RemoveAtSwap(Index);
+	MovementTimers.RemoveAtSwap(Index);
+	MovementDurations.RemoveAtSwap(Index);
+	MoveSpeeds.RemoveAtSwap(Index);
+	SwimHeights.RemoveAtSwap(Index);
+	Profiles.RemoveAtSwap(Index);
+	RandomStreams.RemoveAtSwap(Index);
+	NeedsNewTarget.RemoveAtSwap(Index);
+	TransformDirty.RemoveAtSwap(Index);
+	MeshTransforms.RemoveAtSwap(Index);
+	InstanceComponents.RemoveAtSwap(Index);
+	InstanceIndices.RemoveAtSwap(Index);
+
+	if (Fish.IsValidIndex(Index))
+	{
+		Fish[Index]->SetSimulationIndex(Index);
+	}
+	InFish->SetSimulationIndex(INDEX_NONE);
+}
+
+void FFishSimulation::Step(float DeltaTime, TArray<AFish*>& OutBehaviorFish)
+{
+	const int32 Count = Fish.Num();
+	const EParallelForFlags Flags = Count < MinParallelStepCount
+		                                ? EParallelForFlags::ForceSingleThread
+		                                : EParallelForFlags::None;
+
+	ParallelFor(Count, [this, DeltaTime](int32 i)
+	{
+		if (Behaviors[i] == EFishBehaviorState::Wandering && StepMovement(i, DeltaTime))
+		{
+			EnterIdle(i, GetRandomIdleDuration(i));
+		}
+	}, Flags);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (Behaviors[i] != EFishBehaviorState::Wandering)
+		{
+			OutBehaviorFish.Add(Fish[i]);
+		}
+	}
+}
+
+void FFishSimulation::WriteTransforms()
+{
+	const int32 Count = Fish.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (!TransformDirty[i])
+		{
+			continue;
+		}
+
+		TransformDirty[i] = false;
+
+		UHierarchicalInstancedStaticMeshComponent* InstanceComponent = InstanceComponents[i];
+		if (!InstanceComponent)
+		{
+			Fish[i]->SetActorLocationAndRotation(Locations[i], FRotator(0.f, Yaws[i], 0.f));
+			continue;
+		}
+
+		InstanceComponent->UpdateInstanceTransform(InstanceIndices[i], GetInstanceTransform(i), true, false, true);
+		DirtyInstanceComponents.AddUnique(InstanceComponent);
+	}
+
+	for (UHierarchicalInstancedStaticMeshComponent* InstanceComponent : DirtyInstanceComponents)
+	{
+		InstanceComponent->MarkRenderStateDirty();
+	}
+	DirtyInstanceComponents.Reset();
+}
+
+FTransform FFishSimulation::GetInstanceTransform(int32 Index) const
+{
+	return MeshTransforms[Index] * FTransform(FRotator(0.f, Yaws[Index], 0.f), Locations[Index]);
+}
+
+bool FFishSimulation::StepMovement(int32 Index, float DeltaTime)
+{
+	switch (MovementStates[Index])
+	{
+	case EFishMovementState::Idle:
+		IdleTimers[Index] += DeltaTime;
+		if (IdleTimers[Index] >= IdleDurations[Index] && Behaviors[Index] == EFishBehaviorState::Wandering)
+		{
+			NeedsNewTarget[Index] = true;
+		}
+		return false;
+
+	case EFishMovementState::Rotating:
+		StepRotating(Index, DeltaTime);
+		return false;
+
+	case EFishMovementState::Moving:
+		return StepMoving(Index, DeltaTime);
+	}
+
+	return false;
+}
+
+void FFishSimulation::StepRotating(int32 Index, float DeltaTime)
+{
+	const float Alpha = FMath::Clamp(DeltaTime * Profiles[Index].RotationSpeed, 0.f, 1.f);
+	const float NewYaw = FRotator::NormalizeAxis(
+		Yaws[Index] + FMath::FindDeltaAngleDegrees(Yaws[Index], TargetYaws[Index]) * Alpha);
+
+	Yaws[Index] = NewYaw;
+	TransformDirty[Index] = true;
+
+	if (FMath::Abs(FMath::FindDeltaAngleDegrees(NewYaw, TargetYaws[Index])) < 5.0f)
+	{
+		Yaws[Index] = TargetYaws[Index];
+		StartMoving(Index);
+	}
+}
+
+bool FFishSimulation::StepMoving(int32 Index, float DeltaTime)
+{
+	FVector Direction = Targets[Index] - Locations[Index];
+	Direction.Z = 0.f;
+
+	const float Distance = Direction.Size2D();
+	if (Distance < Profiles[Index].ArrivalThreshold)
+	{
+		return true;
+	}
+
+	MovementTimers[Index] += DeltaTime;
+
+	const float MoveSpeed = MoveSpeeds[Index] * GetSpeedMultiplier(Index);
+	FVector NewLocation = Locations[Index] + (Direction / Distance) * MoveSpeed * DeltaTime;
+	NewLocation.Z = SwimHeights[Index];
+
+	Locations[Index] = NewLocation;
+	TransformDirty[Index] = true;
+	return false;
+}
+
+void FFishSimulation::SetLocation(int32 Index, const FVector& Location)
+{
+	Locations[Index] = Location;
+	TransformDirty[Index] = true;
+}
+
+void FFishSimulation::SetYaw(int32 Index, float Yaw)
+{
+	Yaws[Index] = FRotator::NormalizeAxis(Yaw);
+	TransformDirty[Index] = true;
+}
+
+void FFishSimulation::SetBehavior(int32 Index, EFishBehaviorState Behavior, float MoveSpeed)
+{
+	Behaviors[Index] = Behavior;
+	MoveSpeeds[Index] = MoveSpeed;
+}
+
+void FFishSimulation::StartRotating(int32 Index, const FVector& Target)
+{
+	MovementStates[Index] = EFishMovementState::Rotating;
+	Targets[Index] = Target;
+
+	FVector Direction = Target - Locations[Index];
+	Direction.Z = 0.f;
+	TargetYaws[Index] = Direction.GetSafeNormal().Rotation().Yaw;
+}
+
+void FFishSimulation::StartMoving(int32 Index)
+{
+	MovementStates[Index] = EFishMovementState::Moving;
+	MovementStartLocations[Index] = Locations[Index];
+	MovementTimers[Index] = 0.f;
+
+	const float Distance = FVector::Dist2D(Locations[Index], Targets[Index]);
+	MovementDurations[Index] = MoveSpeeds[Index] > 0.f ? Distance / MoveSpeeds[Index] : 1.0f;
+}
+
+void FFishSimulation::StartTimedMove(int32 Index, const FVector& Target, float Duration)
+{
+	MovementStates[Index] = EFishMovementState::Moving;
+	Targets[Index] = Target;
+	MovementStartLocations[Index] = Locations[Index];
+	MovementTimers[Index] = 0.f;
+	MovementDurations[Index] = Duration;
+}
+
+void FFishSimulation::Retarget(int32 Index, const FVector& Target)
+{
+	Targets[Index] = Target;
+
+	if (MovementStates[Index] == EFishMovementState::Rotating)
+	{
+		FVector Direction = Target - Locations[Index];
+		Direction.Z = 0.f;
+		TargetYaws[Index] = Direction.GetSafeNormal().Rotation().Yaw;
+	}
+	else if (MovementStates[Index] == EFishMovementState::Moving && MoveSpeeds[Index] > 0.f)
+	{
+		MovementDurations[Index] = FVector::Dist2D(Locations[Index], Target) / MoveSpeeds[Index];
+	}
+}
+
+void FFishSimulation::EnterIdle(int32 Index, float Duration)
+{
+	MovementStates[Index] = EFishMovementState::Idle;
+	IdleTimers[Index] = 0.f;
+	IdleDurations[Index] = Duration;
+	NeedsNewTarget[Index] = false;
+	MovementTimers[Index] = 0.f;
+	MovementDurations[Index] = 0.f;
+}
+
+float FFishSimulation::GetRandomIdleDuration(int32 Index, float Scale)
+{
+	return RandomStreams[Index].FRandRange(Profiles[Index].MinIdleTime * Scale, Profiles[Index].MaxIdleTime * Scale);
+}
+
+float FFishSimulation::GetSpeedMultiplier(int32 Index) const
+{
+	const float TotalMovementTime = MovementDurations[Index];
+	if (TotalMovementTime <= 0.f)
+	{
+		return 1.0f;
+	}
+
+	const FFishMovementProfile& Profile = Profiles[Index];
+	const float Progress = FMath::Clamp(MovementTimers[Index] / TotalMovementTime, 0.f, 1.f);
+	float SpeedMultiplier = 1.0f;
+
+	const float AccelPhaseEnd = Profile.AccelerationTime / TotalMovementTime;
+	const float DecelPhaseStart = 1.0f - (Profile.DecelerationTime / TotalMovementTime);
+
+	if (AccelPhaseEnd >= DecelPhaseStart)
+	{
+		if (Progress < 0.5f)
+		{
+			const float LocalProgress = Progress * 2.0f;
+			SpeedMultiplier = FMath::InterpEaseIn(Profile.MinSpeedMultiplier, 1.0f, LocalProgress, 2.0f);
+		}
+		else
+		{
+			const float LocalProgress = (Progress - 0.5f) * 2.0f;
+			SpeedMultiplier = FMath::InterpEaseOut(1.0f, Profile.MinSpeedMultiplier, LocalProgress, 2.0f);
+		}
+	}
+	else
+	{
+		if (Progress < AccelPhaseEnd)
+		{
+			const float LocalProgress = Progress / AccelPhaseEnd;
+			SpeedMultiplier = FMath::InterpEaseIn(Profile.MinSpeedMultiplier, 1.0f, LocalProgress, 2.0f);
+		}
+		else if (Progress > DecelPhaseStart)
+		{
+			const float LocalProgress = (Progress - DecelPhaseStart) / (1.0f - DecelPhaseStart);
+			SpeedMultiplier = FMath::InterpEaseOut(1.0f, Profile.MinSpeedMultiplier, LocalProgress, 2.0f);
+		}
+		else
+		{
+			const float WaveProgress = (Progress - AccelPhaseEnd) / (DecelPhaseStart - AccelPhaseEnd);
+			const float Wave = FMath::Sin(WaveProgress * PI * 2.0f) * Profile.SpeedVariation;
+			SpeedMultiplier = 1.0f + Wave;
+		}
+	}
+
+	return FMath::Clamp(SpeedMultiplier, Profile.MinSpeedMultiplier, 1.0f + Profile.SpeedVariation);
+}
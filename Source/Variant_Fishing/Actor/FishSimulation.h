@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fish.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+
+struct FFishMovementProfile
+{
+	float RotationSpeed = 8.0f;
+	float ArrivalThreshold = 10.f;
+	float MinIdleTime = 2.0f;
+	float MaxIdleTime = 5.0f;
+	float AccelerationTime = 1.0f;
+	float DecelerationTime = 1.0f;
+	float MinSpeedMultiplier = 0.2f;
+	float SpeedVariation = 0.2f;
+};
+
+class FISHING_API FFishSimulation
+{
+public:
+	int32 Add(AFish* InFish, int32 Seed);
+	void Remove(AFish* InFish);
+	int32 Num() const { return Fish.Num(); }
+
+	void Step(float DeltaTime, TArray<AFish*>& OutBehaviorFish);
+	void WriteTransforms();
+
+	bool StepMovement(int32 Index, float DeltaTime);
+	bool StepMoving(int32 Index, float DeltaTime);
+
+	void SetLocation(int32 Index, const FVector& Location);
+	void SetYaw(int32 Index, float Yaw);
+	void SetBehavior(int32 Index, EFishBehaviorState Behavior, float MoveSpeed);
+
+	void StartRotating(int32 Index, const FVector& Target);
+	void StartMoving(int32 Index);
+	void StartTimedMove(int32 Index, const FVector& Target, float Duration);
+	void Retarget(int32 Index, const FVector& Target);
+	void EnterIdle(int32 Index, float Duration);
+	void Stop(int32 Index) { MovementStates[Index] = EFishMovementState::Idle; }
+
+	bool IsInstanced(int32 Index) const { return InstanceComponents[Index] != nullptr; }
+	FTransform GetInstanceTransform(int32 Index) const;
+
+	float GetRandomIdleDuration(int32 Index, float Scale = 1.0f);
+	float GetSpeedMultiplier(int32 Index) const;
+
+	TArray<AFish*> Fish;
+	TArray<EFishBehaviorState> Behaviors;
+	TArray<EFishMovementState> MovementStates;
+	TArray<FVector> Locations;
+	TArray<float> Yaws;
+	TArray<float> TargetYaws;
+	TArray<FVector> Targets;
+	TArray<FVector> MovementStartLocations;
+	TArray<float> IdleTimers;
+	TArray<float> IdleDurations;
+	TArray<float> MovementTimers;
+	TArray<float> MovementDurations;
+	TArray<float> MoveSpeeds;
+	TArray<float> SwimHeights;
+	TArray<FFishMovementProfile> Profiles;
+	TArray<FRandomStream> RandomStreams;
+	TArray<bool> NeedsNewTarget;
+	TArray<bool> TransformDirty;
+	TArray<FTransform> MeshTransforms;
+	TArray<UHierarchicalInstancedStaticMeshComponent*> InstanceComponents;
+	TArray<int32> InstanceIndices;
+
+private:
+	static constexpr int32 MinParallelStepCount = 64;
+
+	TArray<UHierarchicalInstancedStaticMeshComponent*> DirtyInstanceComponents;
+
+	void StepRotating(int32 Index, float DeltaTime);
+};
@@ -0,0 +1,80 @@
+#include "FishSpatialGrid.h"
+
+static constexpr int32 MaxCellsPerAxis = 256;
+
+void FFishSpatialGrid::Initialize(const FVector& InCenter, const FVector& InExtent, float InCellSize)
+{
+	const float CellSize = FMath::Max3(InCellSize, InExtent.X * 2.f / MaxCellsPerAxis, InExtent.Y * 2.f / MaxCellsPerAxis);
+
+	Origin = FVector2D(InCenter.X - InExtent.X, InCenter.Y - InExtent.Y);
+	InvCellSize = 1.f / FMath::Max(CellSize, 1.f);
+	CellsX = FMath::Max(FMath::CeilToInt(InExtent.X * 2.f * InvCellSize), 1);
+	CellsY = FMath::Max(FMath::CeilToInt(InExtent.Y * 2.f * InvCellSize), 1);
+
+	Cells.Reset();
+	Cells.SetNum(CellsX * CellsY);
+	FishCells.Reset();
+}
+
+void FFishSpatialGrid::Reset()
+{
+	for (TArray<AFish*>& Cell : Cells)
+	{
+		Cell.Reset();
+	}
+	FishCells.Reset();
+}
+
+void FFishSpatialGrid::Add(AFish* Fish, const FVector& Location)
+{
+	if (!Fish || !IsInitialized() || FishCells.Contains(Fish))
+	{
+		return;
+	}
+
+	const int32 CellIndex = GetCellIndex(Location);
+	Cells[CellIndex].Add(Fish);
+	FishCells.Add(Fish, CellIndex);
+}
+
+void FFishSpatialGrid::Remove(AFish* Fish)
+{
+	int32 CellIndex;
+	if (FishCells.RemoveAndCopyValue(Fish, CellIndex))
+	{
+		Cells[CellIndex].RemoveSingleSwap(Fish);
+	}
+}
+
+void FFishSpatialGrid::Update(AFish* Fish, const FVector& Location)
+{
+	int32* CellIndex = FishCells.Find(Fish);
+	if (!CellIndex)
+	{
+		Add(Fish, Location);
+		return;
+	}
+
+	const int32 NewCellIndex = GetCellIndex(Location);
+	if (NewCellIndex == *CellIndex)
+	{
+		return;
+	}
+
+	Cells[*CellIndex].RemoveSingleSwap(Fish);
+	Cells[NewCellIndex].Add(Fish);
+	*CellIndex = NewCellIndex;
+}
+
+FIntPoint FFishSpatialGrid::GetCellCoord(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::Clamp(FMath::FloorToInt((Location.X - Origin.X) * InvCellSize), 0, CellsX - 1),
+		FMath::Clamp(FMath::FloorToInt((Location.Y - Origin.Y) * InvCellSize), 0, CellsY - 1));
+}
+
+int32 FFishSpatialGrid::GetCellIndex(const FVector& Location) const
+{
+	const FIntPoint Coord = GetCellCoord(Location);
+	return Coord.Y * CellsX + Coord.X;
+}
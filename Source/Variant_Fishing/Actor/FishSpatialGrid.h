@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AFish;
+
+class FISHING_API FFishSpatialGrid
+{
+public:
+	void Initialize(const FVector& InCenter, const FVector& InExtent, float InCellSize);
+	void Reset();
+
+	void Add(AFish* Fish, const FVector& Location);
+	void Remove(AFish* Fish);
+	void Update(AFish* Fish, const FVector& Location);
+
+	bool IsInitialized() const { return Cells.Num() > 0; }
+	int32 Num() const { return FishCells.Num(); }
+
+	template <typename FunctorType>
+	void ForEachInRadius(const FVector& Center, float Radius, FunctorType&& Func) const
+	{
+		if (!IsInitialized())
+		{
+			return;
+		}
+
+		const FIntPoint Min = GetCellCoord(Center - FVector(Radius, Radius, 0.f));
+		const FIntPoint Max = GetCellCoord(Center + FVector(Radius, Radius, 0.f));
+
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				for (AFish* Fish : Cells[Y * CellsX + X])
+				{
+					Func(Fish);
+				}
+			}
+		}
+	}
+
+private:
+	FIntPoint GetCellCoord(const FVector& Location) const;
+	int32 GetCellIndex(const FVector& Location) const;
+
+	FVector2D Origin = FVector2D::ZeroVector;
+	float InvCellSize = 0.f;
+	int32 CellsX = 0;
+	int32 CellsY = 0;
+
+	TArray<TArray<AFish*>> Cells;
+	TMap<AFish*, int32> FishCells;
+};
@@ -1,14 +1,15 @@
 #include "FishSpawnPool.h"
 #include "Fish.h"
 #include "Variant_Fishing/Data/FishData.h"
-#include "Variant_Fishing/ActorComponent/FishingFeatures/FishingComponent.h"
-#include "FishingCharacter.h"
+#include "Variant_Fishing/Subsystem/BobberRegistrySubsystem.h"
 
 #include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "TimerManager.h"
 #include "DrawDebugHelpers.h"
+#include "Async/ParallelFor.h"
 #include "Fishing.h"
-#include "Kismet/GameplayStatics.h"
 
 
 AFishSpawnPool::AFishSpawnPool()
@@ -45,6 +46,24 @@ void AFishSpawnPool::BeginPlay()
 		return;
 	}
 
+	FishGrid.Initialize(GetActorLocation(), SpawnBox->GetScaledBoxExtent(), SpatialCellSize);
+
+	for (const UFishData* FishData : FishDataList)
+	{
+		if (FishData)
+		{
+			MaxBobberDetectionRange = FMath::Max(MaxBobberDetectionRange, FishData->BobberDetectionRange);
+		}
+	}
+
+	FishSeedBase = SimulationSeed != 0 ? SimulationSeed : FMath::Rand();
+
+	bInstancedRenderingActive = bUseInstancedRendering && GetNetMode() == NM_Standalone;
+	if (bUseInstancedRendering && !bInstancedRenderingActive)
+	{
+		UE_LOG(LogFishSpawnPool, Warning, TEXT("Instanced fish rendering is standalone-only, using actor rendering"));
+	}
+
 	if (bEnablePooling)
 	{
 		PrewarmPool();
@@ -94,6 +113,8 @@ void AFishSpawnPool::Tick(float DeltaTime)
 		ManageFish(DeltaTime);
 	}
 
+	TickSimulation(DeltaTime);
+
 	if (bShowDebugBox && SpawnBox)
 	{
 		FVector BoxExtent = SpawnBox->GetScaledBoxExtent();
@@ -168,6 +189,7 @@ void AFishSpawnPool::ReturnToPool(AFish* Fish)
 		return;
 	}
 
+	RemoveFromSimulation(Fish);
 	Fish->Deactivate();
 	InactiveFishPool.Add(Fish);
 
@@ -176,8 +198,11 @@ void AFishSpawnPool::ReturnToPool(AFish* Fish)
 
 void AFishSpawnPool::ManageFish(float DeltaTime)
 {
+	RefreshFishGrid();
 	TryAssignBobberToFish();
 
+	WanderRequests.Reset();
+
 	for (int i = 0; i < SpawnedFish.Num(); ++i)
 	{
 		auto& Fish = SpawnedFish[i];
@@ -189,7 +214,10 @@ void AFishSpawnPool::ManageFish(float DeltaTime)
 		switch (Fish->GetBehaviorState())
 		{
 		case EFishBehaviorState::Wandering:
-			UpdateWanderingFish(Fish);
+			if (Fish->NeedsNewWanderTarget())
+			{
+				WanderRequests.Add(Fish);
+			}
 			break;
 
 		case EFishBehaviorState::MovingToBobber:
@@ -201,17 +229,183 @@ void AFishSpawnPool::ManageFish(float DeltaTime)
 			break;
 		}
 	}
+
+	AssignWanderTargets();
+}
+
+void AFishSpawnPool::TickSimulation(float DeltaTime)
+{
+	const float SimDeltaTime = DeltaTime * SimulationTimeScale;
+
+	BehaviorFish.Reset();
+	Simulation.Step(SimDeltaTime, BehaviorFish);
+
+	for (AFish* Fish : BehaviorFish)
+	{
+		Fish->TickBehavior(DeltaTime, SimDeltaTime);
+	}
+
+	UpdateFishRepresentations();
+	Simulation.WriteTransforms();
+
+#if ENABLE_DRAW_DEBUG
+	for (AFish* Fish : Simulation.Fish)
+	{
+		if (Fish->IsMovementDebugEnabled())
+		{
+			Fish->DrawMovementDebug();
+		}
+	}
+#endif
+}
+
+void AFishSpawnPool::RemoveFromSimulation(AFish* Fish)
+{
+	const int32 Index = Fish->GetSimulationIndex();
+	if (Simulation.Fish.IsValidIndex(Index) && Simulation.IsInstanced(Index))
+	{
+		PromoteFish(Index);
+	}
+
+	Simulation.Remove(Fish);
+}
+
+void AFishSpawnPool::UpdateFishRepresentations()
+{
+	if (!bInstancedRenderingActive)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Simulation.Num(); ++i)
+	{
+		const bool bWantsInstance = Simulation.Behaviors[i] == EFishBehaviorState::Wandering;
+		if (bWantsInstance && !Simulation.IsInstanced(i))
+		{
+			InstanceFish(i);
+		}
+		else if (!bWantsInstance && Simulation.IsInstanced(i))
+		{
+			PromoteFish(i);
+		}
+	}
+}
+
+void AFishSpawnPool::InstanceFish(int32 Index)
+{
+	AFish* Fish = Simulation.Fish[Index];
+	FFishInstanceBatch* Batch = FindOrCreateInstanceBatch(Fish->GetFishStaticMesh());
+	if (!Batch)
+	{
+		return;
+	}
+
+	Simulation.MeshTransforms[Index] = Fish->GetMeshRelativeTransform();
+	const FTransform InstanceTransform = Simulation.GetInstanceTransform(Index);
+
+	int32 InstanceIndex;
+	if (Batch->FreeInstances.Num() > 0)
+	{
+		InstanceIndex = Batch->FreeInstances.Pop();
+		Batch->Component->UpdateInstanceTransform(InstanceIndex, InstanceTransform, true, true, true);
+	}
+	else
+	{
+		InstanceIndex = Batch->Component->AddInstance(InstanceTransform, true);
+	}
+
+	Simulation.InstanceComponents[Index] = Batch->Component;
+	Simulation.InstanceIndices[Index] = InstanceIndex;
+	Fish->SetRenderedAsInstance(true);
+}
+
+void AFishSpawnPool::PromoteFish(int32 Index)
+{
+	AFish* Fish = Simulation.Fish[Index];
+	UHierarchicalInstancedStaticMeshComponent* Component = Simulation.InstanceComponents[Index];
+	const int32 InstanceIndex = Simulation.InstanceIndices[Index];
+
+	FFishInstanceBatch* Batch = InstanceBatches.Find(Component->GetStaticMesh());
+	if (Batch)
+	{
+		FTransform Hidden = Simulation.GetInstanceTransform(Index);
+		Hidden.SetScale3D(FVector::ZeroVector);
+		Component->UpdateInstanceTransform(InstanceIndex, Hidden, true, true, true);
+		Batch->FreeInstances.Add(InstanceIndex);
+	}
+
+	Simulation.InstanceComponents[Index] = nullptr;
+	Simulation.InstanceIndices[Index] = INDEX_NONE;
+
+	Fish->SetActorLocationAndRotation(Simulation.Locations[Index], FRotator(0.f, Simulation.Yaws[Index], 0.f));
+	Fish->SetRenderedAsInstance(false);
+}
+
+FFishInstanceBatch* AFishSpawnPool::FindOrCreateInstanceBatch(UStaticMesh* Mesh)
+{
+	if (!Mesh)
+	{
+		return nullptr;
+	}
+
+	FFishInstanceBatch* Existing = InstanceBatches.Find(Mesh);
+	if (Existing)
+	{
+		return Existing;
+	}
+
+	UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+	Component->SetStaticMesh(Mesh);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetupAttachment(RootComponent);
+	Component->RegisterComponent();
+	AddInstanceComponent(Component);
+
+	FFishInstanceBatch& Batch = InstanceBatches.Add(Mesh);
+	Batch.Component = Component;
+
+	UE_LOG(LogFishSpawnPool, Log, TEXT("Created fish instance batch for mesh: %s"), *Mesh->GetName());
+	return &Batch;
+}
+
+void AFishSpawnPool::RefreshFishGrid()
+{
+	for (AFish* Fish : SpawnedFish)
+	{
+		if (Fish && Fish->IsActive())
+		{
+			FishGrid.Update(Fish, Fish->GetSimulatedLocation());
+		}
+		else
+		{
+			FishGrid.Remove(Fish);
+		}
+	}
 }
 
-void AFishSpawnPool::UpdateWanderingFish(AFish* Fish)
+void AFishSpawnPool::AssignWanderTargets()
 {
-	if (Fish->NeedsNewWanderTarget())
+	if (WanderRequests.Num() == 0)
 	{
-		FVector NewTarget = GenerateWanderTarget(Fish);
-		Fish->SetWanderTarget(NewTarget);
+		return;
+	}
 
-		UE_LOG(LogFishSpawnPool, Verbose, TEXT("Assigned new wander target to fish"));
+	WanderTargets.SetNumUninitialized(WanderRequests.Num());
+
+	ParallelFor(WanderRequests.Num(), [this](int32 i)
+	{
+		AFish* Fish = WanderRequests[i];
+		FRandomStream& Stream = Simulation.RandomStreams[Fish->GetSimulationIndex()];
+		WanderTargets[i] = GenerateWanderTarget(Fish, Stream);
+	});
+
+	for (int32 i = 0; i < WanderRequests.Num(); ++i)
+	{
+		WanderRequests[i]->SetWanderTarget(WanderTargets[i]);
 	}
+
+	UE_LOG(LogFishSpawnPool, Verbose, TEXT("Assigned new wander targets to %d fish"), WanderRequests.Num());
 }
 
 void AFishSpawnPool::UpdateMovingToBobberFish(AFish* Fish)
@@ -244,22 +438,22 @@ void AFishSpawnPool::UpdateBitingFish(AFish* Fish)
 {
 }
 
-FVector AFishSpawnPool::GenerateWanderTarget(AFish* ForFish)
+FVector AFishSpawnPool::GenerateWanderTarget(AFish* ForFish, FRandomStream& Stream) const
 {
-	FVector BestTarget = ForFish->GetActorLocation();
+	FVector BestTarget = ForFish->GetSimulatedLocation();
 	float BestScore = -FLT_MAX;
 
 	FVector SafeCenter = GetSafeAreaCenter();
 	FVector SafeExtent = GetSafeAreaExtent();
-	FVector FishLoc = ForFish->GetActorLocation();
-	FVector FishForward = ForFish->GetActorForwardVector();
+	FVector FishLoc = ForFish->GetSimulatedLocation();
+	FVector FishForward = ForFish->GetSimulatedForward();
 
 	constexpr int32 NumCandidates = 12;
 	for (int32 i = 0; i < NumCandidates; ++i)
 	{
 		FVector Candidate = SafeCenter + FVector(
-			FMath::FRandRange(-SafeExtent.X, SafeExtent.X),
-			FMath::FRandRange(-SafeExtent.Y, SafeExtent.Y),
+			Stream.FRandRange(-SafeExtent.X, SafeExtent.X),
+			Stream.FRandRange(-SafeExtent.Y, SafeExtent.Y),
 			0.f
 		);
 		Candidate.Z = FishLoc.Z;
@@ -271,17 +465,17 @@ FVector AFishSpawnPool::GenerateWanderTarget(AFish* ForFish)
 
 		float Score = 0.f;
 
-		float MinDistanceToOthers = FLT_MAX;
-		for (AFish* OtherFish : SpawnedFish)
+		float MinDistanceToOthers = WanderSpacingSearchRadius;
+		FishGrid.ForEachInRadius(Candidate, WanderSpacingSearchRadius, [&](AFish* OtherFish)
 		{
 			if (OtherFish == ForFish || !OtherFish->IsActive())
 			{
-				continue;
+				return;
 			}
 
-			float Dist = FVector::Dist2D(Candidate, OtherFish->GetActorLocation());
+			float Dist = FVector::Dist2D(Candidate, OtherFish->GetSimulatedLocation());
 			MinDistanceToOthers = FMath::Min(MinDistanceToOthers, Dist);
-		}
+		});
 		Score += MinDistanceToOthers * 0.5f;
 
 		float DistFromCenter = FVector::Dist2D(Candidate, SafeCenter);
@@ -324,21 +518,19 @@ bool AFishSpawnPool::IsGoodWanderTarget(const FVector& Target, AFish* ForFish) c
 		return false;
 	}
 
-	for (AFish* OtherFish : SpawnedFish)
+	bool bTooClose = false;
+	FishGrid.ForEachInRadius(Target, MinDistanceBetweenFish, [&](AFish* OtherFish)
 	{
-		if (OtherFish == ForFish || !OtherFish->IsActive())
+		if (bTooClose || OtherFish == ForFish || !OtherFish->IsActive())
 		{
-			continue;
+			return;
 		}
 
-		float Dist = FVector::Dist2D(Target, OtherFish->GetActorLocation());
-		if (Dist < MinDistanceBetweenFish)
-		{
-			return false;
-		}
-	}
+		float Dist = FVector::Dist2D(Target, OtherFish->GetSimulatedLocation());
+		bTooClose = Dist < MinDistanceBetweenFish;
+	});
 
-	return true;
+	return !bTooClose;
 }
 
 FVector AFishSpawnPool::GetSafeAreaCenter() const
@@ -370,6 +562,7 @@ void AFishSpawnPool::OnFishStartVanishing(AFish* Fish)
 
 	UnassignFish(Fish);
 	SpawnedFish.Remove(Fish);
+	FishGrid.Remove(Fish);
 
 	UE_LOG(LogFishSpawnPool, Verbose, TEXT("Fish start vanishing -> removed from SpawnedFish (Active: %d)"),
 	       SpawnedFish.Num());
@@ -388,6 +581,7 @@ void AFishSpawnPool::OnFishVanished(AFish* Fish)
 	}
 	else
 	{
+		RemoveFromSimulation(Fish);
 		Fish->Destroy();
 	}
 	UE_LOG(LogFishSpawnPool, Log, TEXT("Fish vanished -> returned/destroyed (Active: %d, Pooled: %d)"),
@@ -397,10 +591,28 @@ void AFishSpawnPool::OnFishVanished(AFish* Fish)
 void AFishSpawnPool::TryAssignBobberToFish()
 {
 	TArray<UStaticMeshComponent*> Bobbers = FindAllVisibleBobbers();
+	if (Bobbers.Num() == 0)
+	{
+		return;
+	}
+
+	TSet<AFish*> CandidateFish;
+	for (UStaticMeshComponent* Bobber : Bobbers)
+	{
+		FishGrid.ForEachInRadius(Bobber->GetComponentLocation(), MaxBobberDetectionRange, [&CandidateFish](AFish* Fish)
+		{
+			CandidateFish.Add(Fish);
+		});
+	}
+
+	if (CandidateFish.Num() == 0)
+	{
+		return;
+	}
 
 	for (AFish* Fish : SpawnedFish)
 	{
-		if (!Fish || !Fish->IsActive())
+		if (!Fish || !Fish->IsActive() || !CandidateFish.Contains(Fish))
 		{
 			continue;
 		}
@@ -549,6 +761,8 @@ AFish* AFishSpawnPool::SpawnFish(UFishData* FishData)
 
 	Fish->Activate(FishData, SpawnLocation);
 	SpawnedFish.Add(Fish);
+	FishGrid.Add(Fish, SpawnLocation);
+	Simulation.Add(Fish, (int32)HashCombine(GetTypeHash(FishSeedBase), GetTypeHash(FishSpawnCount++)));
 
 	return Fish;
 }
@@ -606,6 +820,7 @@ void AFishSpawnPool::RemoveFish(AFish* Fish, bool bCaught)
 
 	UnassignFish(Fish);
 	SpawnedFish.Remove(Fish);
+	FishGrid.Remove(Fish);
 
 	if (bCaught)
 	{
@@ -624,6 +839,7 @@ void AFishSpawnPool::RemoveFish(AFish* Fish, bool bCaught)
 	}
 	else
 	{
+		RemoveFromSimulation(Fish);
 		Fish->Destroy();
 	}
 }
@@ -666,26 +882,17 @@ TArray<UStaticMeshComponent*> AFishSpawnPool::FindAllVisibleBobbers()
 {
 	TArray<UStaticMeshComponent*> Result;
 
-	TArray<AActor*> Characters;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AFishingCharacter::StaticClass(), Characters);
-
-	for (AActor* Actor : Characters)
+	UBobberRegistrySubsystem* Registry = UBobberRegistrySubsystem::Get(GetWorld());
+	if (!Registry)
 	{
-		AFishingCharacter* FishChar = Cast<AFishingCharacter>(Actor);
-		if (!FishChar || !FishChar->CoreFishingComponent)
-		{
-			continue;
-		}
-		if (!FishChar->CoreFishingComponent->IsFishing())
-		{
-			continue;
-		}
+		return Result;
+	}
 
-		UStaticMeshComponent* Bobber = FishChar->CoreFishingComponent->GetBobber();
-		if (Bobber && Bobber->IsVisible())
-		{
-			Result.Add(Bobber);
-		}
+	const TArray<FActiveBobber>& ActiveBobbers = Registry->GetActiveBobbers();
+	Result.Reserve(ActiveBobbers.Num());
+	for (const FActiveBobber& Active : ActiveBobbers)
+	{
+		Result.Add(Active.Bobber);
 	}
 
 	return Result;
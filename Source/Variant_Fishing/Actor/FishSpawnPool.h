@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "FishSpatialGrid.h"
+#include "FishSimulation.h"
 #include "FishSpawnPool.generated.h"
 
 
@@ -9,6 +11,8 @@ class UBoxComponent;
 class UFishData;
 class AFish;
 class UStaticMeshComponent;
+class UStaticMesh;
+class UHierarchicalInstancedStaticMeshComponent;
 
 USTRUCT()
 struct FFishBobberAssignment
@@ -24,6 +28,17 @@ struct FFishBobberAssignment
 	float AssignedTime = 0.f;
 };
 
+USTRUCT()
+struct FFishInstanceBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+
+	TArray<int32> FreeInstances;
+};
+
 UCLASS()
 class FISHING_API AFishSpawnPool : public AActor
 {
@@ -59,6 +74,9 @@ public:
 	void OnFishStartVanishing(AFish* Fish);
 	void OnFishVanished(AFish* Fish);
 
+	FFishSimulation& GetSimulation() { return Simulation; }
+	const FFishSimulation& GetSimulation() const { return Simulation; }
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -89,6 +107,18 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="FishPool|Movement")
 	float ForwardSpacePreference = 200.f;
 
+	UPROPERTY(EditDefaultsOnly, Category="FishPool|Movement")
+	float WanderSpacingSearchRadius = 600.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="FishPool|Movement", meta=(ClampMin="0.0"))
+	float SimulationTimeScale = 2.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category="FishPool|Movement")
+	int32 SimulationSeed = 0;
+
+	UPROPERTY(EditDefaultsOnly, Category="FishPool|Rendering")
+	bool bUseInstancedRendering = false;
+
 	UPROPERTY(EditDefaultsOnly, Category="FishPool|Pooling")
 	int32 PrewarmPoolSize = 10;
 
@@ -98,6 +128,9 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="FishPool|Management")
 	float ManagementTickInterval = 0.2f;
 
+	UPROPERTY(EditDefaultsOnly, Category="FishPool|Management", meta=(ClampMin="10.0"))
+	float SpatialCellSize = 200.f;
+
 	UPROPERTY(EditDefaultsOnly, Category="FishPool|Debug")
 	bool bShowDebugBox = true;
 
@@ -115,6 +148,20 @@ protected:
 
 	TArray<FFishBobberAssignment> BobberAssignments;
 
+	UPROPERTY()
+	TMap<TObjectPtr<UStaticMesh>, FFishInstanceBatch> InstanceBatches;
+
+	bool bInstancedRenderingActive = false;
+
+	FFishSpatialGrid FishGrid;
+	FFishSimulation Simulation;
+	TArray<AFish*> BehaviorFish;
+	TArray<AFish*> WanderRequests;
+	TArray<FVector> WanderTargets;
+	int32 FishSeedBase = 0;
+	int32 FishSpawnCount = 0;
+	float MaxBobberDetectionRange = 0.f;
+
 	FTimerHandle SpawnTimerHandle;
 	float EmptyTime;
 	float ManagementTickTimer;
@@ -130,11 +177,19 @@ protected:
 	void ReturnToPool(AFish* Fish);
 
 	void ManageFish(float DeltaTime);
-	void UpdateWanderingFish(AFish* Fish);
+	void TickSimulation(float DeltaTime);
+	void RemoveFromSimulation(AFish* Fish);
+
+	void UpdateFishRepresentations();
+	void InstanceFish(int32 Index);
+	void PromoteFish(int32 Index);
+	FFishInstanceBatch* FindOrCreateInstanceBatch(UStaticMesh* Mesh);
+	void RefreshFishGrid();
+	void AssignWanderTargets();
 	void UpdateMovingToBobberFish(AFish* Fish);
 	void UpdateBitingFish(AFish* Fish);
 
-	FVector GenerateWanderTarget(AFish* ForFish);
+	FVector GenerateWanderTarget(AFish* ForFish, FRandomStream& Stream) const;
 	bool IsGoodWanderTarget(const FVector& Target, AFish* ForFish) const;
 	FVector GetSafeAreaCenter() const;
 	FVector GetSafeAreaExtent() const;
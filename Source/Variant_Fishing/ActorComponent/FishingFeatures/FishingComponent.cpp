@@ -20,6 +20,7 @@
 #include "Variant_Fishing/Actor/ItemActor.h"
 #include "Variant_Fishing/Data/FishData.h"
 #include "Variant_Fishing/Database/DatabaseManager.h"
+#include "Variant_Fishing/Subsystem/BobberRegistrySubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogFishingComponent);
 
@@ -61,6 +62,16 @@ void UFishingComponent::BeginPlay()
 	UE_LOG(LogFishingComponent, Log, TEXT("FishingComponent BeginPlay - All modules created"));
 }
 
+void UFishingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UBobberRegistrySubsystem* Registry = UBobberRegistrySubsystem::Get(GetWorld()))
+	{
+		Registry->UnregisterBobber(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UFishingComponent::Initialize(USkeletalMeshComponent* InCharacterMesh,
                                    UStaticMeshComponent* InFishingRod,
                                    UStaticMeshComponent* InBobber,
@@ -3,6 +3,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "NiagaraComponent.h"
 #include "Variant_Fishing/ActorComponent/FishingFeatures/FishingComponent.h"
+#include "Variant_Fishing/Subsystem/BobberRegistrySubsystem.h"
 
 void UFishingBobberModule::Initialize(UFishingComponent* InOwner, 
                                       UStaticMeshComponent* InBobber, 
@@ -71,6 +72,11 @@ void UFishingBobberModule::Show(const FVector& TargetLocation)
 	{
 		OwnerComponent->bBobberActive = true;
 		OwnerComponent->BobberTargetLocation = TargetLocation;
+
+		if (UBobberRegistrySubsystem* Registry = UBobberRegistrySubsystem::Get(OwnerComponent->GetWorld()))
+		{
+			Registry->RegisterBobber(OwnerComponent, Bobber);
+		}
 	}
 
 	PlaySplashEffect(0.5f);
@@ -103,6 +109,11 @@ void UFishingBobberModule::Hide()
 	if (OwnerComponent)
 	{
 		OwnerComponent->bBobberActive = false;
+
+		if (UBobberRegistrySubsystem* Registry = UBobberRegistrySubsystem::Get(OwnerComponent->GetWorld()))
+		{
+			Registry->UnregisterBobber(OwnerComponent);
+		}
 	}
 
 	UE_LOG(LogFishingComponent, Log, TEXT("Bobber hidden"));
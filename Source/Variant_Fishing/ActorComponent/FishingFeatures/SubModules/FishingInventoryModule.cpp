@@ -94,9 +94,9 @@ void UFishingInventoryModule::CreateFishItemFromCatch(AFish* CaughtFish, int32 P
         UDatabaseManager* DatabaseManager = GI->GetSubsystem<UDatabaseManager>();
         if (DatabaseManager)
         {
-            DatabaseManager->RecordCaughtFish(
+            DatabaseManager->QueueCaughtFish(
                 PlayerID,
-                TEXT("TEMP"),
+                FishData->GetPathName(),
                 FishStats.FishDataName,
                 FishStats.ActualLength,
                 FishStats.ActualWeight
@@ -183,13 +183,19 @@ void UInventoryComponent::OnRep_ItemSyncData()
     }
     
     
-    Storage->ApplySyncData(ItemSyncData);
-    
-    
-    RefreshAllItems();
-    RefreshGridLayout();
-    
-    UE_LOG(LogInventory, Log, TEXT("OnRep_ItemSyncData: Sync complete"));
+    TWeakObjectPtr<UInventoryComponent> WeakThis(this);
+    Storage->ApplySyncData(ItemSyncData, [WeakThis]()
+    {
+        if (!WeakThis.IsValid())
+        {
+            return;
+        }
+        
+        WeakThis->RefreshAllItems();
+        WeakThis->RefreshGridLayout();
+        
+        UE_LOG(LogInventory, Log, TEXT("OnRep_ItemSyncData: Sync complete"));
+    });
 }
 
 
@@ -404,6 +410,7 @@ bool UInventoryComponent::TryAddItem(UItemBase* ItemToAdd)
     
     if (bSuccess)
     {
+        MarkItemDirty(ItemToAdd);
         
         if (GetOwnerRole() == ROLE_Authority)
         {
@@ -457,6 +464,7 @@ bool UInventoryComponent::RemoveItem(UItemBase* ItemToRemove)
     
     if (bSuccess)
     {
+        MarkItemRemoved(ItemToRemove);
         
         if (GetOwnerRole() == ROLE_Authority)
         {
@@ -482,6 +490,7 @@ void UInventoryComponent::AddItemAt(UItemBase* ItemToAdd, int32 TopLeftIndex)
     
     if (ItemHandler->AddItemAt(ItemToAdd, TopLeftIndex))
     {
+        MarkItemDirty(ItemToAdd);
         
         if (GetOwnerRole() == ROLE_Authority)
         {
@@ -519,6 +528,7 @@ void UInventoryComponent::Server_MoveItem_Implementation(UItemBase* Item, FIntPo
     
     if (ItemHandler->MoveItem(Item, NewTopLeftTile))
     {
+        MarkItemDirty(Item);
         
         SyncToClients();
         
@@ -610,6 +620,7 @@ void UInventoryComponent::Server_DropItemToWorld_Implementation(UItemBase* ItemT
     
     if (ItemHandler->RemoveItem(ItemToDrop))
     {
+        MarkItemRemoved(ItemToDrop);
         
         SyncToClients();
         
@@ -668,6 +679,7 @@ void UInventoryComponent::AddItemAtForServer_Implementation(UItemBase* ItemToAdd
     
     if (ItemHandler->AddItemAt(ItemToAdd, TopLeftIndex))
     {
+        MarkItemDirty(ItemToAdd);
         
         SyncToClients();
         
@@ -737,7 +749,7 @@ void UInventoryComponent::ResizeItemsToGrid(bool bZeroInit)
     Storage->ResizeStorage(bZeroInit);
 }
 
-bool UInventoryComponent::SaveInventoryToDatabase(int32 PlayerID)
+bool UInventoryComponent::SaveInventoryToDatabase(int32 PlayerID, bool bAsync)
 {
     
     if (GetOwnerRole() != ROLE_Authority)
@@ -770,9 +782,72 @@ bool UInventoryComponent::SaveInventoryToDatabase(int32 PlayerID)
     
     TMap<UItemBase*, FIntPoint> ItemsWithPositions = Storage->GetAllUniqueItems();
 
+    if (!bFullSaveRequired && LastSavedPlayerID == PlayerID)
+    {
+        if (!HasUnsavedChanges())
+        {
+            UE_LOG(LogInventory, Verbose, TEXT("SaveInventoryToDatabase: No changes for PlayerID=%d"), PlayerID);
+            return true;
+        }
+
+        TMap<UItemBase*, FIntPoint> ChangedItems = CollectChangedItems(ItemsWithPositions);
+        TArray<FGuid> RemovedGuids = RemovedItemGuids.Array();
+
+        UE_LOG(LogInventory, Log, TEXT("SaveInventoryToDatabase: Saving %d changed, %d removed for PlayerID=%d"),
+               ChangedItems.Num(), RemovedGuids.Num(), PlayerID);
+
+        ResetSaveTracking(PlayerID);
+
+        if (bAsync)
+        {
+            TWeakObjectPtr<UInventoryComponent> WeakThis(this);
+            DatabaseManager->SaveInventoryChangesAsync(PlayerID, ChangedItems, RemovedGuids, [WeakThis](bool bSaved)
+            {
+                if (!bSaved && WeakThis.IsValid())
+                {
+                    UE_LOG(LogInventory, Error, TEXT("SaveInventoryToDatabase: Async change save failed!"));
+                    WeakThis->RequireFullSave();
+                }
+            });
+            return true;
+        }
+
+        const bool bSaved = DatabaseManager->SaveInventoryChanges(PlayerID, ChangedItems, RemovedGuids);
+        if (!bSaved)
+        {
+            UE_LOG(LogInventory, Error, TEXT("SaveInventoryToDatabase: Change save failed!"));
+            RequireFullSave();
+        }
+        return bSaved;
+    }
+
     UE_LOG(LogInventory, Log, TEXT("SaveInventoryToDatabase: Saving %d items for PlayerID=%d"),
            ItemsWithPositions.Num(), PlayerID);
 
+    ResetSaveTracking(PlayerID);
+
+    if (bAsync)
+    {
+        const int32 ItemCount = ItemsWithPositions.Num();
+        TWeakObjectPtr<UInventoryComponent> WeakThis(this);
+        DatabaseManager->SaveInventoryAsync(PlayerID, ItemsWithPositions, [WeakThis, ItemCount](bool bSaved)
+        {
+            if (bSaved)
+            {
+                UE_LOG(LogInventory, Log, TEXT("SaveInventoryToDatabase: Async save finished (%d items)"), ItemCount);
+            }
+            else
+            {
+                UE_LOG(LogInventory, Error, TEXT("SaveInventoryToDatabase: Async save failed!"));
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->RequireFullSave();
+                }
+            }
+        });
+        return true;
+    }
+
     
     bool bSuccess = DatabaseManager->SaveInventory(PlayerID, ItemsWithPositions);
 
@@ -784,12 +859,13 @@ bool UInventoryComponent::SaveInventoryToDatabase(int32 PlayerID)
     else
     {
         UE_LOG(LogInventory, Error, TEXT("âŒ SaveInventoryToDatabase: Failed!"));
+        RequireFullSave();
     }
 
     return bSuccess;
 }
 
-bool UInventoryComponent::LoadInventoryFromDatabase(int32 PlayerID)
+bool UInventoryComponent::LoadInventoryFromDatabase(int32 PlayerID, bool bAsync)
 {
     
     if (GetOwnerRole() != ROLE_Authority)
@@ -821,11 +897,35 @@ bool UInventoryComponent::LoadInventoryFromDatabase(int32 PlayerID)
 
     UE_LOG(LogInventory, Log, TEXT("LoadInventoryFromDatabase: Loading inventory for PlayerID=%d"), PlayerID);
 
+    if (bAsync)
+    {
+        TWeakObjectPtr<UInventoryComponent> WeakThis(this);
+        DatabaseManager->LoadInventoryAsync(PlayerID, this,
+            [WeakThis, PlayerID](const TMap<UItemBase*, FIntPoint>& LoadedItems)
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->ApplyLoadedItems(PlayerID, LoadedItems);
+                }
+            });
+        return true;
+    }
+
     
-    Storage->ClearAll();
+    ApplyLoadedItems(PlayerID, DatabaseManager->LoadInventory(PlayerID, this));
+    return true;
+}
+
+void UInventoryComponent::ApplyLoadedItems(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& LoadedItems)
+{
+    if (!Storage || !ItemHandler || !GridManager)
+    {
+        return;
+    }
 
     
-    TMap<UItemBase*, FIntPoint> LoadedItems = DatabaseManager->LoadInventory(PlayerID, this);
+    Storage->ClearAll();
+    ResetSaveTracking(PlayerID);
 
     if (LoadedItems.Num() == 0)
     {
@@ -834,7 +934,7 @@ bool UInventoryComponent::LoadInventoryFromDatabase(int32 PlayerID)
         
         SyncToClients();
         NotifyItemsChanged();
-        return true;
+        return;
     }
 
     UE_LOG(LogInventory, Log, TEXT("LoadInventoryFromDatabase: Loaded %d items from database"), 
@@ -899,8 +999,6 @@ bool UInventoryComponent::LoadInventoryFromDatabase(int32 PlayerID)
 
     UE_LOG(LogInventory, Log, TEXT("âœ… LoadInventoryFromDatabase: Complete! (PlayerID=%d, Items=%d)"),
            PlayerID, PlacedCount);
-
-    return true;
 }
 
 void UInventoryComponent::ClearAllItems()
@@ -915,6 +1013,7 @@ void UInventoryComponent::ClearAllItems()
 
     
     Storage->ClearAll();
+    RequireFullSave();
 
     
     if (GetOwnerRole() == ROLE_Authority)
@@ -928,6 +1027,85 @@ void UInventoryComponent::ClearAllItems()
     UE_LOG(LogInventory, Log, TEXT("âœ… ClearAllItems: Complete"));
 }
 
+void UInventoryComponent::MarkItemDirty(UItemBase* Item)
+{
+    if (!Item || !Item->ItemGuid.IsValid())
+    {
+        return;
+    }
+
+    RemovedItemGuids.Remove(Item->ItemGuid);
+    DirtyItemGuids.Add(Item->ItemGuid);
+}
+
+void UInventoryComponent::MarkItemRemoved(UItemBase* Item)
+{
+    if (!Item || !Item->ItemGuid.IsValid())
+    {
+        return;
+    }
+
+    DirtyItemGuids.Remove(Item->ItemGuid);
+    RemovedItemGuids.Add(Item->ItemGuid);
+}
+
+bool UInventoryComponent::CaptureSaveSnapshot(int32 PlayerID, FPlayerSaveSnapshot& OutSnapshot)
+{
+    if (GetOwnerRole() != ROLE_Authority || PlayerID < 0 || !Storage)
+    {
+        return false;
+    }
+
+    const TMap<UItemBase*, FIntPoint> ItemsWithPositions = Storage->GetAllUniqueItems();
+
+    OutSnapshot.PlayerID = PlayerID;
+    OutSnapshot.bFullInventory = bFullSaveRequired || LastSavedPlayerID != PlayerID;
+
+    if (OutSnapshot.bFullInventory)
+    {
+        OutSnapshot.Inventory = UDatabaseManager::CaptureInventorySnapshot(ItemsWithPositions);
+    }
+    else
+    {
+        OutSnapshot.Inventory = UDatabaseManager::CaptureInventorySnapshot(CollectChangedItems(ItemsWithPositions));
+        OutSnapshot.RemovedItemGuids = RemovedItemGuids.Array();
+    }
+
+    ResetSaveTracking(PlayerID);
+    return true;
+}
+
+TMap<UItemBase*, FIntPoint> UInventoryComponent::CollectChangedItems(const TMap<UItemBase*, FIntPoint>& ItemsWithPositions) const
+{
+    TMap<UItemBase*, FIntPoint> ChangedItems;
+    for (const auto& Pair : ItemsWithPositions)
+    {
+        if (Pair.Key && DirtyItemGuids.Contains(Pair.Key->ItemGuid))
+        {
+            ChangedItems.Add(Pair.Key, Pair.Value);
+        }
+    }
+    return ChangedItems;
+}
+
+bool UInventoryComponent::HasUnsavedChanges() const
+{
+    return bFullSaveRequired || DirtyItemGuids.Num() > 0 || RemovedItemGuids.Num() > 0;
+}
+
+void UInventoryComponent::ResetSaveTracking(int32 SavedPlayerID)
+{
+    DirtyItemGuids.Reset();
+    RemovedItemGuids.Reset();
+    bFullSaveRequired = false;
+    LastSavedPlayerID = SavedPlayerID;
+}
+
+void UInventoryComponent::RequireFullSave()
+{
+    bFullSaveRequired = true;
+}
+
 bool UInventoryComponent::GetResultAtIndex(int32 Index)
 {
     if (!GridManager)
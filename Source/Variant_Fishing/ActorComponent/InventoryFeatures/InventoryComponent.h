@@ -12,6 +12,8 @@
 #include "FishingCharacter.h"
 #include "InventoryComponent.generated.h"
 
+struct FPlayerSaveSnapshot;
+
 class UInventoryWidget;
 class UInventoryDescriptionWidget;
 class AItemActor;
@@ -166,14 +168,23 @@ public:
 
     
     UFUNCTION(BlueprintCallable, Category = "Inventory|Database")
-    bool SaveInventoryToDatabase(int32 PlayerID);
+    bool SaveInventoryToDatabase(int32 PlayerID, bool bAsync = false);
 
     UFUNCTION(BlueprintCallable, Category = "Inventory|Database")
-    bool LoadInventoryFromDatabase(int32 PlayerID);
+    bool LoadInventoryFromDatabase(int32 PlayerID, bool bAsync = false);
 
     UFUNCTION(BlueprintCallable, Category = "Inventory|Database")
     void ClearAllItems();
 
+    UFUNCTION(BlueprintCallable, Category = "Inventory|Database")
+    void MarkItemDirty(UItemBase* Item);
+
+    UFUNCTION(BlueprintPure, Category = "Inventory|Database")
+    bool HasUnsavedChanges() const;
+
+    bool CaptureSaveSnapshot(int32 PlayerID, FPlayerSaveSnapshot& OutSnapshot);
+    void RequireFullSave();
+
 
     
 protected:
@@ -205,6 +216,16 @@ protected:
 
 private:
     void InitializeModules();
+    void ApplyLoadedItems(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& LoadedItems);
+    
+    void MarkItemRemoved(UItemBase* Item);
+    void ResetSaveTracking(int32 SavedPlayerID);
+    TMap<UItemBase*, FIntPoint> CollectChangedItems(const TMap<UItemBase*, FIntPoint>& ItemsWithPositions) const;
+    
+    TSet<FGuid> DirtyItemGuids;
+    TSet<FGuid> RemovedItemGuids;
+    bool bFullSaveRequired = true;
+    int32 LastSavedPlayerID = -1;
     bool GetResultAtIndex(int32 Index);
     bool IsReplicationOff = false;
     
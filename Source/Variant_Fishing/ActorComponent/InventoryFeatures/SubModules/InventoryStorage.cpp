@@ -5,6 +5,7 @@
 #include "Variant_Fishing/Data/ItemBase.h"
 #include "Variant_Fishing/Data/FishData.h"
 #include "Engine/AssetManager.h"
+#include "Variant_Fishing/GameInstance/ItemAssetSubsystem.h"
 
 void UInventoryStorage::Initialize(UInventoryGridManager* InGridManager, UObject* InOuter)
 {
@@ -162,7 +163,7 @@ TArray<FItemSyncData> UInventoryStorage::GenerateSyncData() const
 
 
 
-void UInventoryStorage::ApplySyncData(const TArray<FItemSyncData>& SyncData)
+void UInventoryStorage::ApplySyncData(const TArray<FItemSyncData>& SyncData, TFunction<void()> OnApplied)
 {
     if (!GridManager || !Outer)
     {
@@ -172,7 +173,45 @@ void UInventoryStorage::ApplySyncData(const TArray<FItemSyncData>& SyncData)
     
     UE_LOG(LogInventoryStorage, Log, TEXT("ApplySyncData: Applying %d sync entries"), 
            SyncData.Num());
-    
+
+    const int32 RequestSerial = ++SyncRequestSerial;
+
+    UItemAssetSubsystem* AssetSubsystem = UItemAssetSubsystem::Get(Outer);
+    if (!AssetSubsystem)
+    {
+        PlaceSyncData(SyncData);
+        if (OnApplied)
+        {
+            OnApplied();
+        }
+        return;
+    }
+
+    TArray<FSoftObjectPath> AssetPaths;
+    AssetPaths.Reserve(SyncData.Num());
+    for (const FItemSyncData& Data : SyncData)
+    {
+        AssetPaths.AddUnique(Data.DataAssetPath);
+    }
+
+    TWeakObjectPtr<UInventoryStorage> WeakThis(this);
+    AssetSubsystem->LoadAssetsAsync(AssetPaths, [WeakThis, RequestSerial, SyncData, OnApplied = MoveTemp(OnApplied)]()
+    {
+        if (!WeakThis.IsValid() || WeakThis->SyncRequestSerial != RequestSerial)
+        {
+            return;
+        }
+
+        WeakThis->PlaceSyncData(SyncData);
+        if (OnApplied)
+        {
+            OnApplied();
+        }
+    });
+}
+
+void UInventoryStorage::PlaceSyncData(const TArray<FItemSyncData>& SyncData)
+{
     
     ClearAll();
     
@@ -181,7 +220,7 @@ void UInventoryStorage::ApplySyncData(const TArray<FItemSyncData>& SyncData)
     {
         if (!Data.IsValid())
         {
-            UE_LOG(LogInventoryStorage, Warning, TEXT("ApplySyncData: Invalid sync data"));
+            UE_LOG(LogInventoryStorage, Warning, TEXT("PlaceSyncData: Invalid sync data"));
             continue;
         }
         
@@ -192,7 +231,7 @@ void UInventoryStorage::ApplySyncData(const TArray<FItemSyncData>& SyncData)
     
     RefreshUniqueItemsCache();
     
-    UE_LOG(LogInventoryStorage, Log, TEXT("ApplySyncData: Complete. %d unique items placed"),
+    UE_LOG(LogInventoryStorage, Log, TEXT("PlaceSyncData: Complete. %d unique items placed"),
            CachedUniqueItems.Num());
 }
 
@@ -208,7 +247,9 @@ void UInventoryStorage::CreateItemFromSyncData(const FItemSyncData& SyncData)
     }
 
     
-    UObject* LoadedAsset = SyncData.DataAssetPath.TryLoad();
+    UItemAssetSubsystem* AssetSubsystem = UItemAssetSubsystem::Get(Outer);
+    UObject* LoadedAsset = AssetSubsystem ? AssetSubsystem->LoadAssetSync(SyncData.DataAssetPath)
+                                          : SyncData.DataAssetPath.TryLoad();
     
     if (!LoadedAsset)
     {
@@ -37,7 +37,7 @@ public:
     
 	
 	TArray<FItemSyncData> GenerateSyncData() const;
-	void ApplySyncData(const TArray<FItemSyncData>& SyncData);
+	void ApplySyncData(const TArray<FItemSyncData>& SyncData, TFunction<void()> OnApplied = nullptr);
     
 	FString DumpStorageContents() const;
 	void PlaceItemInGrid(UItemBase* Item, int32 TopLeftIndex);
@@ -55,8 +55,10 @@ private:
 	UPROPERTY()
 	UObject* Outer;
     
+	int32 SyncRequestSerial = 0;
 	
 	
 
+	void PlaceSyncData(const TArray<FItemSyncData>& SyncData);
 	void CreateItemFromSyncData(const FItemSyncData& SyncData);
 };
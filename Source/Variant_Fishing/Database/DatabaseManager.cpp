@@ -2,28 +2,441 @@
 #include "Variant_Fishing/Database/DatabaseManager.h"
 
 #include "Fishing.h"
+#include "Variant_Fishing/Database/DatabaseSettings.h"
 #include "SQLiteDatabase.h"
 #include "Variant_Fishing/Data/ItemBase.h"
 #include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
 #include "Dom/JsonObject.h"
+#include "Misc/ScopeExit.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "HAL/FileManager.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Variant_Fishing/Widget/LeaderboardEntryWidget.h"
+#include "Variant_Fishing/GameInstance/ItemAssetSubsystem.h"
+
+static constexpr int32 InventoryInsertColumnCount = 7;
+static constexpr int32 InventoryInsertBatchSize = 64;
+static constexpr uint8 SpecificDataVersion = 1;
+static constexpr int32 OperationSampleCount = 256;
+
+DECLARE_STATS_GROUP(TEXT("FishingDatabase"), STATGROUP_FishingDatabase, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("SaveInventory"), STAT_Database_SaveInventory, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("SaveInventoryChanges"), STAT_Database_SaveInventoryChanges, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("LoadInventory"), STAT_Database_LoadInventory, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("RecordCaughtFish"), STAT_Database_RecordCaughtFish, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("SaveSession"), STAT_Database_SaveSession, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("SavePlayerMoney"), STAT_Database_SavePlayerMoney, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("LoadPlayerData"), STAT_Database_LoadPlayerData, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("GetSessionLeaderboard"), STAT_Database_GetSessionLeaderboard, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("GetSessionLeaderboardPage"), STAT_Database_GetSessionLeaderboardPage, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("GetAllSaveSlots"), STAT_Database_GetAllSaveSlots, STATGROUP_FishingDatabase);
+DECLARE_CYCLE_STAT(TEXT("DeleteSaveSlot"), STAT_Database_DeleteSaveSlot, STATGROUP_FishingDatabase);
+DECLARE_MEMORY_STAT(TEXT("Database File"), STAT_Database_FileSize, STATGROUP_FishingDatabase);
+DECLARE_MEMORY_STAT(TEXT("WAL File"), STAT_Database_WalSize, STATGROUP_FishingDatabase);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Statement Cache Hit %"), STAT_Database_StatementCacheHitRatio, STATGROUP_FishingDatabase);
+
+CSV_DEFINE_CATEGORY(FishingDatabase, true);
+
+class FScopedDatabaseOperation
+{
+public:
+	FScopedDatabaseOperation(UDatabaseManager& InManager, FName InOperation)
+		: Manager(InManager)
+		, Operation(InOperation)
+		, StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FScopedDatabaseOperation()
+	{
+		Manager.RecordOperation(Operation, (FPlatformTime::Seconds() - StartTime) * 1000.0, Rows);
+	}
+
+	void SetRows(int32 InRows) { Rows = InRows; }
+
+private:
+	UDatabaseManager& Manager;
+	FName Operation;
+	double StartTime;
+	int32 Rows = 0;
+};
+
+#define DATABASE_OPERATION_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_Database_##Name); \
+	CSV_SCOPED_TIMING_STAT(FishingDatabase, Name); \
+	FScopedDatabaseOperation OperationScope(*this, TEXT(#Name))
+
+static int64 GetFileSizeOrZero(const FString& Path)
+{
+	return FMath::Max<int64>(IFileManager::Get().FileSize(*Path), 0);
+}
+
+static float GetSamplePercentile(TArray<float> Samples, float Percentile)
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	Samples.Sort();
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Samples.Num()) - 1, 0, Samples.Num() - 1);
+	return Samples[Index];
+}
+
+static FString BuildInventoryInsertQuery(int32 RowCount)
+{
+	FString Query = TEXT(
+		"INSERT INTO InventoryItems (PlayerID, ItemGuid, DefinitionID, "
+		"GridX, GridY, bIsRotated, SpecificData) VALUES ");
+
+	for (int32 i = 0; i < RowCount; i++)
+	{
+		Query += (i == 0) ? TEXT("(?, ?, ?, ?, ?, ?, ?)") : TEXT(", (?, ?, ?, ?, ?, ?, ?)");
+	}
+	return Query;
+}
+
+static void BindInventoryRecord(FSQLitePreparedStatement& Stmt, int32 RowIndex, int32 PlayerID,
+	int32 DefinitionID, const FInventoryItemRecord& Record)
+{
+	const int32 Base = RowIndex * InventoryInsertColumnCount;
+	Stmt.SetBindingValueByIndex(Base + 1, PlayerID);
+	Stmt.SetBindingValueByIndex(Base + 2, Record.ItemGuid);
+	Stmt.SetBindingValueByIndex(Base + 3, DefinitionID);
+	Stmt.SetBindingValueByIndex(Base + 4, Record.GridPosition.X);
+	Stmt.SetBindingValueByIndex(Base + 5, Record.GridPosition.Y);
+	Stmt.SetBindingValueByIndex(Base + 6, Record.bIsRotated ? 1 : 0);
+	if (Record.SpecificData.Num() > 0)
+	{
+		Stmt.SetBindingValueByIndex(Base + 7, TArrayView<const uint8>(Record.SpecificData));
+	}
+	else
+	{
+		Stmt.SetBindingValueByIndex(Base + 7);
+	}
+}
+
+static FString BuildPlayersTableQuery(const TCHAR* TableName)
+{
+	return FString::Printf(TEXT(
+		"CREATE TABLE IF NOT EXISTS %s ("
+		"PlayerID INTEGER PRIMARY KEY AUTOINCREMENT, "
+		"PlayerName TEXT NOT NULL, "
+		"VillageName TEXT NOT NULL UNIQUE, "
+		"TotalMoney INTEGER DEFAULT 0, "
+		"LastSaveTime TEXT, "
+		"CreatedAt TEXT DEFAULT CURRENT_TIMESTAMP, "
+		"HostPlayerID INTEGER DEFAULT NULL REFERENCES Players(PlayerID) ON DELETE CASCADE, "
+		"IsHost INTEGER DEFAULT 0)"), TableName);
+}
+
+static FString BuildInventoryItemsTableQuery(const TCHAR* TableName)
+{
+	return FString::Printf(TEXT(
+		"CREATE TABLE IF NOT EXISTS %s ("
+		"ItemID INTEGER PRIMARY KEY AUTOINCREMENT, "
+		"PlayerID INTEGER NOT NULL, "
+		"ItemGuid TEXT UNIQUE NOT NULL, "
+		"DefinitionID INTEGER NOT NULL, "
+		"GridX INTEGER DEFAULT 0, "
+		"GridY INTEGER DEFAULT 0, "
+		"bIsRotated INTEGER DEFAULT 0, "
+		"SpecificData BLOB, "
+		"FOREIGN KEY (PlayerID) REFERENCES Players(PlayerID) ON DELETE CASCADE, "
+		"FOREIGN KEY (DefinitionID) REFERENCES ItemDefinitions(DefinitionID))"), TableName);
+}
+
+static FString BuildFishRecordsTableQuery(const TCHAR* TableName)
+{
+	return FString::Printf(TEXT(
+		"CREATE TABLE IF NOT EXISTS %s ("
+		"RecordID INTEGER PRIMARY KEY AUTOINCREMENT, "
+		"PlayerID INTEGER NOT NULL, "
+		"FishDefinitionID INTEGER NOT NULL, "
+		"FishName TEXT NOT NULL, "
+		"CaughtCount INTEGER DEFAULT 0, "
+		"LargestLength REAL DEFAULT 0.0, "
+		"LargestWeight REAL DEFAULT 0.0, "
+		"FirstCaughtAt TEXT, "
+		"LastCaughtAt TEXT, "
+		"FOREIGN KEY (PlayerID) REFERENCES Players(PlayerID) ON DELETE CASCADE, "
+		"FOREIGN KEY (FishDefinitionID) REFERENCES ItemDefinitions(DefinitionID), "
+		"UNIQUE(PlayerID, FishDefinitionID))"), TableName);
+}
+
+static FString BuildSessionLeaderboardTableQuery(const TCHAR* TableName)
+{
+	return FString::Printf(TEXT(
+		"CREATE TABLE IF NOT EXISTS %s ("
+		"EntryID INTEGER PRIMARY KEY AUTOINCREMENT, "
+		"SessionHostID INTEGER NOT NULL, "
+		"PlayerID INTEGER NOT NULL, "
+		"FishDefinitionID INTEGER NOT NULL, "
+		"PlayerName TEXT NOT NULL, "
+		"FishName TEXT NOT NULL, "
+		"LargestLength REAL DEFAULT 0.0, "
+		"LargestWeight REAL DEFAULT 0.0, "
+		"CaughtCount INTEGER DEFAULT 0, "
+		"LastCaughtAt TEXT, "
+		"FOREIGN KEY (SessionHostID) REFERENCES Players(PlayerID) ON DELETE CASCADE, "
+		"FOREIGN KEY (PlayerID) REFERENCES Players(PlayerID) ON DELETE CASCADE, "
+		"UNIQUE(PlayerID, FishDefinitionID))"), TableName);
+}
+
+static const TCHAR* GetLeaderboardSortColumn(ELeaderboardSortType SortType)
+{
+	switch (SortType)
+	{
+	case ELeaderboardSortType::HeaviestWeight: return TEXT("LargestWeight DESC");
+	case ELeaderboardSortType::MostCaught:     return TEXT("CaughtCount DESC");
+	case ELeaderboardSortType::RecentCatch:    return TEXT("LastCaughtAt DESC");
+	default:                                    return TEXT("LargestLength DESC");
+	}
+}
+
+static const TCHAR* SessionLeaderboardUpsertQuery = TEXT(
+	"INSERT INTO SessionLeaderboard (SessionHostID, PlayerID, FishDefinitionID, PlayerName, FishName, "
+	"LargestLength, LargestWeight, CaughtCount, LastCaughtAt) "
+	"SELECT COALESCE(P.HostPlayerID, P.PlayerID), F.PlayerID, F.FishDefinitionID, P.PlayerName, F.FishName, "
+	"F.LargestLength, F.LargestWeight, F.CaughtCount, F.LastCaughtAt "
+	"FROM FishRecords F "
+	"JOIN Players P ON P.PlayerID = F.PlayerID "
+	"WHERE F.PlayerID = ? AND F.FishDefinitionID = ? "
+	"ON CONFLICT(PlayerID, FishDefinitionID) DO UPDATE SET "
+	"SessionHostID = excluded.SessionHostID, "
+	"PlayerName = excluded.PlayerName, "
+	"FishName = excluded.FishName, "
+	"LargestLength = excluded.LargestLength, "
+	"LargestWeight = excluded.LargestWeight, "
+	"CaughtCount = excluded.CaughtCount, "
+	"LastCaughtAt = excluded.LastCaughtAt");
+
+static const TCHAR* AutoBackupPrefix = TEXT("Auto_");
+
+static FString GetBackupPath(const FString& BackupName)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Backups"), BackupName + TEXT(".db"));
+}
+
+static void LogUnwrittenCatches(const TArray<FCaughtFishRecord>& Records, const TCHAR* Reason)
+{
+	UE_LOG(LogDatabase, Error, TEXT("❌ %d caught fish were not written (%s)"), Records.Num(), Reason);
+	for (const FCaughtFishRecord& Record : Records)
+	{
+		UE_LOG(LogDatabase, Error, TEXT("   PlayerID=%d Fish=%s Path=%s Length=%.2f Weight=%.2f CaughtAt=%s"),
+			Record.PlayerID, *Record.FishName, *Record.FishDataPath, Record.Length, Record.Weight, *Record.CaughtAt);
+	}
+}
+
+static bool WriteDatabaseSnapshot(FSQLiteDatabase& Source, const FString& BackupPath)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(BackupPath));
+
+	if (PlatformFile.FileExists(*BackupPath))
+	{
+		PlatformFile.DeleteFile(*BackupPath);
+	}
+
+	FSQLitePreparedStatement Statement;
+	if (!Statement.Create(Source, TEXT("VACUUM INTO ?")))
+	{
+		UE_LOG(LogDatabase, Error, TEXT("❌ Backup failed: %s"), *Source.GetLastError());
+		return false;
+	}
+
+	Statement.SetBindingValueByIndex(1, BackupPath);
+	const bool bSuccess = Statement.Execute();
+	if (!bSuccess)
+	{
+		UE_LOG(LogDatabase, Error, TEXT("❌ Backup failed: %s"), *Source.GetLastError());
+	}
+	Statement.Destroy();
+	return bSuccess;
+}
+
+static void RotateAutoBackups(int32 KeepCount)
+{
+	const FString BackupDir = FPaths::GetPath(GetBackupPath(AutoBackupPrefix));
+
+	TArray<FString> BackupFiles;
+	IFileManager::Get().FindFiles(BackupFiles, *FPaths::Combine(BackupDir, FString(AutoBackupPrefix) + TEXT("*.db")), true, false);
+	if (BackupFiles.Num() <= KeepCount)
+	{
+		return;
+	}
+
+	BackupFiles.Sort();
+	for (int32 i = 0; i < BackupFiles.Num() - KeepCount; i++)
+	{
+		IFileManager::Get().Delete(*FPaths::Combine(BackupDir, BackupFiles[i]));
+		UE_LOG(LogDatabase, Log, TEXT("Rotated out backup: %s"), *BackupFiles[i]);
+	}
+}
+
+static TSet<FString> GetTableColumns(FSQLiteDatabase& Database, const TCHAR* TableName)
+{
+	TSet<FString> Columns;
+
+	FSQLitePreparedStatement Statement;
+	if (!Statement.Create(Database, *FString::Printf(TEXT("PRAGMA table_info(%s)"), TableName)))
+	{
+		return Columns;
+	}
+
+	while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	{
+		FString ColumnName;
+		Statement.GetColumnValueByIndex(1, ColumnName);
+		Columns.Add(ColumnName);
+	}
+	return Columns;
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs GBenchmarkInventorySaveCommand(
+	TEXT("Fishing.DB.BenchmarkInventorySave"),
+	TEXT("Compares per-row and batched InventoryItems inserts. Usage: Fishing.DB.BenchmarkInventorySave [Counts...]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		UDatabaseManager* DatabaseManager = GameInstance ? GameInstance->GetSubsystem<UDatabaseManager>() : nullptr;
+		if (!DatabaseManager)
+		{
+			UE_LOG(LogDatabase, Warning, TEXT("BenchmarkInventorySave: DatabaseManager not found"));
+			return;
+		}
+
+		TArray<int32> ItemCounts;
+		for (const FString& Arg : Args)
+		{
+			const int32 Count = FCString::Atoi(*Arg);
+			if (Count > 0)
+			{
+				ItemCounts.Add(Count);
+			}
+		}
+		if (ItemCounts.Num() == 0)
+		{
+			ItemCounts = { 10, 100, 1000 };
+		}
+
+		DatabaseManager->BenchmarkInventoryInserts(ItemCounts);
+	}));
+#endif
+
+static FAutoConsoleCommandWithWorldAndArgs GDatabaseStatsCommand(
+	TEXT("Fishing.DB.Stats"),
+	TEXT("Logs per-operation query latency, database size and cache statistics. Usage: Fishing.DB.Stats [reset]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		UDatabaseManager* DatabaseManager = GameInstance ? GameInstance->GetSubsystem<UDatabaseManager>() : nullptr;
+		if (!DatabaseManager)
+		{
+			UE_LOG(LogDatabase, Warning, TEXT("Stats: DatabaseManager not found"));
+			return;
+		}
+
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			DatabaseManager->ResetTelemetry();
+			return;
+		}
+
+		DatabaseManager->LogTelemetry();
+	}));
 
 void UDatabaseManager::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	UE_LOG(LogDatabase, Log, TEXT("DatabaseManager initialized"));
+
+	DatabaseWorker = MakeUnique<FDatabaseWorker>();
+	DatabaseWorker->Start();
+
+	const UDatabaseSettings* Settings = GetDefault<UDatabaseSettings>();
+	if (Settings->bUseReadConnection)
+	{
+		ReadWorker = MakeUnique<FDatabaseWorker>();
+		if (!ReadWorker->Start())
+		{
+			ReadWorker.Reset();
+		}
+	}
+
+	MaxPendingCatches = FMath::Max(Settings->MaxPendingCatches, 1);
+	MaxQueuedCatches = FMath::Max(Settings->MaxQueuedCatches, MaxPendingCatches);
+	bShuttingDown = false;
+	PendingCatches.Reserve(MaxPendingCatches);
+	CatchLogTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UDatabaseManager::TickCatchLog),
+		FMath::Max(Settings->CatchLogFlushInterval, 0.1f));
+
+	if (Settings->AutoBackupInterval > 0.0f)
+	{
+		AutoBackupTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UDatabaseManager::TickAutoBackup),
+			Settings->AutoBackupInterval * 60.0f);
+	}
+
 	OpenDatabase();
 }
 
 void UDatabaseManager::Deinitialize()
 {
+	FTSTicker::GetCoreTicker().RemoveTicker(CatchLogTickerHandle);
+	CatchLogTickerHandle.Reset();
+	FTSTicker::GetCoreTicker().RemoveTicker(AutoBackupTickerHandle);
+	AutoBackupTickerHandle.Reset();
+
+	bShuttingDown = true;
+	TArray<FCaughtFishRecord> FinalCatches = TakePendingCatches();
+	if (FinalCatches.Num() > 0)
+	{
+		const int32 Written = RunOnDatabaseThread<int32>([this, &FinalCatches]() {
+			return WriteCaughtFishBatch(FinalCatches);
+		});
+		if (Written == INDEX_NONE)
+		{
+			LogUnwrittenCatches(FinalCatches, TEXT("shutdown flush failed"));
+		}
+	}
+
+	if (BackupFuture.IsValid())
+	{
+		BackupFuture.Wait();
+	}
+
 	CloseDatabase();
+
+	if (DatabaseWorker)
+	{
+		DatabaseWorker->Shutdown();
+		DatabaseWorker.Reset();
+	}
+
+	if (ReadWorker)
+	{
+		ReadWorker->Shutdown();
+		ReadWorker.Reset();
+	}
+
 	Super::Deinitialize();
 }
 
 bool UDatabaseManager::OpenDatabase(const FString& DatabaseName)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, DatabaseName]() { return OpenDatabase(DatabaseName); });
+	}
+
 	if (Database && Database->IsValid())
 	{
 		UE_LOG(LogDatabase, Warning, TEXT("Database already open"));
@@ -52,16 +465,125 @@ bool UDatabaseManager::OpenDatabase(const FString& DatabaseName)
 		return false;
 	}
 
+	ApplyDatabaseSettings();
 	InitializeTables();
+
+	if (ReadWorker)
+	{
+		bReadConnectionOpen = ReadWorker->ExecuteBlocking<bool>([this]() { return OpenReadConnection(); });
+	}
+	return true;
+}
+
+bool UDatabaseManager::OpenReadConnection()
+{
+	if (ReadDatabase && ReadDatabase->IsValid())
+	{
+		return true;
+	}
+
+	ReadDatabase = new FSQLiteDatabase();
+
+	if (!ReadDatabase->Open(*DatabaseFilePath, ESQLiteDatabaseOpenMode::ReadOnly))
+	{
+		UE_LOG(LogDatabase, Warning, TEXT("Failed to open read connection, queries share the write connection: %s"),
+			*ReadDatabase->GetLastError());
+		delete ReadDatabase;
+		ReadDatabase = nullptr;
+		return false;
+	}
+
+	FString JournalMode;
+	FSQLitePreparedStatement Statement;
+	if (Statement.Create(*ReadDatabase, TEXT("PRAGMA journal_mode;")) && Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	{
+		Statement.GetColumnValueByIndex(0, JournalMode);
+	}
+	Statement.Destroy();
+
+	if (!JournalMode.Equals(TEXT("wal"), ESearchCase::IgnoreCase))
+	{
+		UE_LOG(LogDatabase, Warning, TEXT("Read connection requires WAL (journal_mode=%s), queries share the write connection"),
+			*JournalMode);
+		ReadDatabase->Close();
+		delete ReadDatabase;
+		ReadDatabase = nullptr;
+		return false;
+	}
+
+	for (const FString& Pragma : GetDefault<UDatabaseSettings>()->BuildReadPragmas())
+	{
+		if (!ReadDatabase->Execute(*Pragma))
+		{
+			UE_LOG(LogDatabase, Warning, TEXT("Failed to apply '%s' on read connection: %s"), *Pragma, *ReadDatabase->GetLastError());
+		}
+	}
+
+	UE_LOG(LogDatabase, Log, TEXT("✅ Read connection opened"));
 	return true;
 }
 
+void UDatabaseManager::CloseReadConnection()
+{
+	if (!ReadDatabase)
+	{
+		return;
+	}
+
+	for (TPair<FString, TUniquePtr<FSQLitePreparedStatement>>& Pair : ReadStatementCache)
+	{
+		Pair.Value->Destroy();
+	}
+	ReadStatementCache.Empty();
+	ReadDatabase->Close();
+	delete ReadDatabase;
+	ReadDatabase = nullptr;
+	UE_LOG(LogDatabase, Log, TEXT("Read connection closed"));
+}
+
+void UDatabaseManager::ApplyDatabaseSettings()
+{
+	const UDatabaseSettings* Settings = GetDefault<UDatabaseSettings>();
+
+	for (const FString& Pragma : Settings->BuildPragmas())
+	{
+		if (!Database->Execute(*Pragma))
+		{
+			UE_LOG(LogDatabase, Warning, TEXT("Failed to apply '%s': %s"), *Pragma, *Database->GetLastError());
+		}
+	}
+
+	FSQLitePreparedStatement Statement;
+	if (Statement.Create(*Database, TEXT("PRAGMA journal_mode;")) && Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	{
+		FString JournalMode;
+		Statement.GetColumnValueByIndex(0, JournalMode);
+		UE_LOG(LogDatabase, Log, TEXT("Database journal_mode=%s"), *JournalMode);
+	}
+	Statement.Destroy();
+}
+
 void UDatabaseManager::CloseDatabase()
 {
+	if (!IsInDatabaseThread())
+	{
+		RunOnDatabaseThread<bool>([this]() { CloseDatabase(); return true; });
+		return;
+	}
+
+	if (ReadWorker)
+	{
+		bReadConnectionOpen = false;
+		ReadWorker->ExecuteBlocking<bool>([this]() { CloseReadConnection(); return true; });
+	}
+
 	if (!Database)
 	{
 		return;
 	}
+	ClearStatementCache();
+	ItemDefinitionIDs.Empty();
+	ItemDefinitions.Empty();
 	Database->Close();
 	delete Database;
 	Database = nullptr;
@@ -70,116 +592,188 @@ void UDatabaseManager::CloseDatabase()
 
 bool UDatabaseManager::InitializeTables()
 {
+    if (!IsInDatabaseThread())
+    {
+        return RunOnDatabaseThread<bool>([this]() { return InitializeTables(); });
+    }
+
     if (!Database || !Database->IsValid())
     {
         return false;
     }
 
-    TArray<FString> Queries = {
-        TEXT(
-            "CREATE TABLE IF NOT EXISTS Players ("
-            "PlayerID INTEGER PRIMARY KEY AUTOINCREMENT, "
-            "PlayerName TEXT NOT NULL, "
-            "VillageName TEXT NOT NULL UNIQUE, "
-            "TotalMoney INTEGER DEFAULT 0, "
-            "LastSaveTime TEXT, "
-            "CreatedAt TEXT DEFAULT CURRENT_TIMESTAMP)"
-        ),
-        TEXT(
-            "CREATE TABLE IF NOT EXISTS InventoryItems ("
-            "ItemID INTEGER PRIMARY KEY AUTOINCREMENT, "
-            "PlayerID INTEGER NOT NULL, "
-            "ItemGuid TEXT UNIQUE NOT NULL, "
-            "ItemDataProviderPath TEXT NOT NULL, "
-            "ItemCategory TEXT NOT NULL, "
-            "GridX INTEGER DEFAULT 0, "
-            "GridY INTEGER DEFAULT 0, "
-            "bIsRotated INTEGER DEFAULT 0, "
-            "SpecificDataJSON TEXT, "
-            "FOREIGN KEY (PlayerID) REFERENCES Players(PlayerID))"
-        ),
+    bool bSuccess = MigrateDatabase();
+    bSuccess &= Database->Execute(TEXT("PRAGMA foreign_keys = ON;"));
+    bSuccess &= LoadItemDefinitions();
+	
+    return bSuccess;
+}
+
+bool UDatabaseManager::CreateBaseTables()
+{
+    TArray<FString> TableQueries = {
+        BuildPlayersTableQuery(TEXT("Players")),
         TEXT(
-            "CREATE TABLE IF NOT EXISTS FishRecords ("
-            "RecordID INTEGER PRIMARY KEY AUTOINCREMENT, "
-            "PlayerID INTEGER NOT NULL, "
-            "FishDataPath TEXT NOT NULL, "
-            "FishName TEXT NOT NULL, "
-            "CaughtCount INTEGER DEFAULT 0, "
-            "LargestLength REAL DEFAULT 0.0, "
-            "LargestWeight REAL DEFAULT 0.0, "
-            "FirstCaughtAt TEXT, "
-            "LastCaughtAt TEXT, "
-            "FOREIGN KEY (PlayerID) REFERENCES Players(PlayerID), "
-            "UNIQUE(PlayerID, FishDataPath))"
+            "CREATE TABLE IF NOT EXISTS ItemDefinitions ("
+            "DefinitionID INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "AssetPath TEXT NOT NULL UNIQUE, "
+            "Category TEXT)"
         ),
-        TEXT("CREATE INDEX IF NOT EXISTS idx_inventory_player ON InventoryItems(PlayerID)"),
-        TEXT("CREATE INDEX IF NOT EXISTS idx_fish_records ON FishRecords(PlayerID, FishDataPath)")
+        BuildInventoryItemsTableQuery(TEXT("InventoryItems")),
+        BuildFishRecordsTableQuery(TEXT("FishRecords")),
+        BuildSessionLeaderboardTableQuery(TEXT("SessionLeaderboard"))
     };
 
-    bool bSuccess = true;
-    for (const FString& Query : Queries)
+    for (const FString& Query : TableQueries)
     {
         if (!ExecuteQuery(Query))
         {
-            bSuccess = false;
+            return false;
         }
     }
+    return true;
+}
 
-    if (bSuccess)
+bool UDatabaseManager::MigrateSessionPlayers()
+{
+    const TSet<FString> PlayerColumns = GetTableColumns(*Database, TEXT("Players"));
+
+    if (!PlayerColumns.Contains(TEXT("HostPlayerID")))
     {
-        bSuccess &= MigrateDatabase();
+        if (!ExecuteQuery(TEXT("ALTER TABLE Players ADD COLUMN HostPlayerID INTEGER DEFAULT NULL")))
+        {
+            return false;
+        }
+        UE_LOG(LogDatabase, Log, TEXT("✅ Added HostPlayerID column"));
     }
-	
-    return bSuccess;
-}
 
+    if (!PlayerColumns.Contains(TEXT("IsHost")))
+    {
+        if (!ExecuteQuery(TEXT("ALTER TABLE Players ADD COLUMN IsHost INTEGER DEFAULT 0")))
+        {
+            return false;
+        }
+        UE_LOG(LogDatabase, Log, TEXT("✅ Added IsHost column"));
+
+        ExecuteQuery(TEXT("UPDATE Players SET IsHost = 1 WHERE IsHost IS NULL OR IsHost = 0"));
+    }
 
+    return ExecuteQuery(TEXT("CREATE INDEX IF NOT EXISTS idx_session_players ON Players(HostPlayerID)"));
+}
 
+bool UDatabaseManager::CreateQueryIndexes()
+{
+    TArray<FString> IndexQueries = {
+        TEXT("DROP INDEX IF EXISTS idx_fish_records_leaderboard"),
+        TEXT("DROP INDEX IF EXISTS idx_fish_records_weight"),
+        TEXT("DROP INDEX IF EXISTS idx_fish_records_count"),
+        TEXT("DROP INDEX IF EXISTS idx_fish_records_recent"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_session_players ON Players(HostPlayerID)"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_inventory_player ON InventoryItems(PlayerID)"),
+        TEXT("CREATE UNIQUE INDEX IF NOT EXISTS idx_inventory_player_guid ON InventoryItems(PlayerID, ItemGuid)"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_session_leaderboard_length ON SessionLeaderboard(SessionHostID, LargestLength DESC)"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_session_leaderboard_weight ON SessionLeaderboard(SessionHostID, LargestWeight DESC)"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_session_leaderboard_count ON SessionLeaderboard(SessionHostID, CaughtCount DESC)"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_session_leaderboard_recent ON SessionLeaderboard(SessionHostID, LastCaughtAt DESC)"),
+        TEXT("CREATE INDEX IF NOT EXISTS idx_session_leaderboard_fish ON SessionLeaderboard(SessionHostID, FishName)")
+    };
 
+    for (const FString& Query : IndexQueries)
+    {
+        if (!ExecuteQuery(Query))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
 TArray<FSaveSlotInfo> UDatabaseManager::GetAllSaveSlots()
 {
+	if (!IsInReadThread())
+	{
+		return RunOnReadThread<TArray<FSaveSlotInfo>>([this]() { return GetAllSaveSlots(); });
+	}
+
+	DATABASE_OPERATION_SCOPE(GetAllSaveSlots);
+
 	TArray<FSaveSlotInfo> SaveSlots;
-	if (!Database || !Database->IsValid())
+	if (!IsConnectionOpen())
 	{
 		UE_LOG(LogDatabase, Error, TEXT("Database not open"));
 		return SaveSlots;
 	}
 
 	FString Query = TEXT(
-		"SELECT PlayerID, PlayerName, VillageName, TotalMoney, LastSaveTime, HostPlayerID, IsHost "
-		"FROM Players WHERE IsHost = 1 ORDER BY LastSaveTime DESC"
+		"SELECT P.PlayerID, P.PlayerName, P.VillageName, P.TotalMoney, P.LastSaveTime, P.HostPlayerID, P.IsHost, "
+		"(SELECT COUNT(*) FROM Players G WHERE G.HostPlayerID = P.PlayerID AND G.PlayerID <> P.PlayerID), "
+		"(SELECT COALESCE(SUM(L.CaughtCount), 0) FROM SessionLeaderboard L WHERE L.SessionHostID = P.PlayerID), "
+		"B.FishName, COALESCE(B.LargestLength, 0) "
+		"FROM Players P "
+		"LEFT JOIN SessionLeaderboard B ON B.EntryID = ("
+		"SELECT L.EntryID FROM SessionLeaderboard L WHERE L.SessionHostID = P.PlayerID "
+		"ORDER BY L.LargestLength DESC LIMIT 1) "
+		"WHERE P.IsHost = 1 ORDER BY P.LastSaveTime DESC"
 	);
 
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(Query);
+	if (!Statement)
 	{
 		return SaveSlots;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
-	while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
 		FSaveSlotInfo Info;
 		int32 TempIsHost;
         
-		Statement.GetColumnValueByIndex(0, Info.PlayerID);
-		Statement.GetColumnValueByIndex(1, Info.PlayerName);
-		Statement.GetColumnValueByIndex(2, Info.VillageName);
-		Statement.GetColumnValueByIndex(3, Info.TotalMoney);
-		Statement.GetColumnValueByIndex(4, Info.LastSaveTime);
-		Statement.GetColumnValueByIndex(5, Info.HostPlayerID);
-		Statement.GetColumnValueByIndex(6, TempIsHost);
+		Statement->GetColumnValueByIndex(0, Info.PlayerID);
+		Statement->GetColumnValueByIndex(1, Info.PlayerName);
+		Statement->GetColumnValueByIndex(2, Info.VillageName);
+		Statement->GetColumnValueByIndex(3, Info.TotalMoney);
+		Statement->GetColumnValueByIndex(4, Info.LastSaveTime);
+		Statement->GetColumnValueByIndex(5, Info.HostPlayerID);
+		Statement->GetColumnValueByIndex(6, TempIsHost);
 		Info.bIsHost = (TempIsHost != 0);
+		Statement->GetColumnValueByIndex(7, Info.GuestCount);
+		Statement->GetColumnValueByIndex(8, Info.TotalFishCaught);
+		Statement->GetColumnValueByIndex(9, Info.BestCatchName);
+		Statement->GetColumnValueByIndex(10, Info.BestCatchLength);
         
 		SaveSlots.Add(Info);
 	}
 
+	OperationScope.SetRows(SaveSlots.Num());
 	UE_LOG(LogDatabase, Log, TEXT("Loaded %d save slots"), SaveSlots.Num());
 	return SaveSlots;
 }
 
-int32 UDatabaseManager::FindOrCreateSaveSlot(const FString& PlayerName, const FString& VillageName)
+void UDatabaseManager::GetAllSaveSlotsAsync(TFunction<void(const TArray<FSaveSlotInfo>&)> OnComplete,
+	EDatabaseReadConsistency Consistency)
 {
+	RunOnReadThreadAsync<TArray<FSaveSlotInfo>>(
+		[this]() {
+			return GetAllSaveSlots();
+		},
+		[OnComplete = MoveTemp(OnComplete)](TArray<FSaveSlotInfo>&& SaveSlots) {
+			if (OnComplete)
+			{
+				OnComplete(SaveSlots);
+			}
+		},
+		Consistency);
+}
+
+int32 UDatabaseManager::FindOrCreateSaveSlot(const FString& PlayerName, const FString& VillageName)
+{
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<int32>([this, &PlayerName, &VillageName]() {
+			return FindOrCreateSaveSlot(PlayerName, VillageName);
+		});
+	}
+
 	if (!Database || !Database->IsValid())
 	{
 		UE_LOG(LogDatabase, Error, TEXT("Database not open"));
@@ -221,6 +815,13 @@ int32 UDatabaseManager::FindOrCreateSaveSlot(const FString& PlayerName, const FS
 
 bool UDatabaseManager::DeleteSaveSlot(const FString& VillageName)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, &VillageName]() { return DeleteSaveSlot(VillageName); });
+	}
+
+	DATABASE_OPERATION_SCOPE(DeleteSaveSlot);
+
 	if (!Database || !Database->IsValid())
 	{
 		return false;
@@ -243,38 +844,64 @@ bool UDatabaseManager::DeleteSaveSlot(const FString& VillageName)
 		return false;
 	}
 
-	bool bSuccess = true;
-	
-	
-	TArray<int32> SessionPlayers = GetSessionPlayers(PlayerID);
-	for (int32 SessionPlayerID : SessionPlayers)
+	int32 DeletedPlayers = 0;
+	const bool bSuccess = DeletePlayerData(PlayerID)
+		&& ExecuteScalarInt(TEXT("SELECT changes()"), nullptr, DeletedPlayers);
+
+	if (!bSuccess)
+	{
+		RollbackTransaction();
+		UE_LOG(LogDatabase, Error, TEXT("❌ Failed to delete save slot: %s"), *VillageName);
+		return false;
+	}
+
+	CommitTransaction();
+	OperationScope.SetRows(DeletedPlayers);
+	UE_LOG(LogDatabase, Log, TEXT("✅ Deleted save slot and %d session players: %s"),
+		FMath::Max(DeletedPlayers - 1, 0), *VillageName);
+
+	if (GetDefault<UDatabaseSettings>()->bReclaimSpaceOnDelete)
 	{
-		if (!DeletePlayerData(SessionPlayerID))
+		if (DatabaseWorker)
+		{
+			DatabaseWorker->Enqueue([this]() { ReclaimFreePages(); });
+		}
+		else
 		{
-			bSuccess = false;
-			break;
+			ReclaimFreePages();
 		}
 	}
-	
-	
-	if (bSuccess)
+
+	return true;
+}
+
+void UDatabaseManager::ReclaimFreePages()
+{
+	if (!Database || !Database->IsValid())
 	{
-		bSuccess = DeletePlayerData(PlayerID);
+		return;
 	}
 
-	if (bSuccess)
+	int32 AutoVacuumMode = 0;
+	ExecuteScalarInt(TEXT("PRAGMA auto_vacuum"), nullptr, AutoVacuumMode);
+
+	if (AutoVacuumMode != 2)
 	{
-		CommitTransaction();
-		UE_LOG(LogDatabase, Log, TEXT("✅ Deleted save slot and %d session players: %s"), 
-			SessionPlayers.Num(), *VillageName);
+		UE_LOG(LogDatabase, Verbose, TEXT("Skipped page reclaim: auto_vacuum=%d is not incremental"), AutoVacuumMode);
+		return;
+	}
+
+	const FString Query = FString::Printf(TEXT("PRAGMA incremental_vacuum(%d);"),
+		FMath::Max(GetDefault<UDatabaseSettings>()->ReclaimPagesPerDelete, 1));
+
+	if (Database->Execute(*Query))
+	{
+		UE_LOG(LogDatabase, Log, TEXT("✅ Reclaimed free pages (%s)"), *Query);
 	}
 	else
 	{
-		RollbackTransaction();
-		UE_LOG(LogDatabase, Error, TEXT("❌ Failed to delete save slot: %s"), *VillageName);
+		UE_LOG(LogDatabase, Warning, TEXT("Failed to reclaim free pages: %s"), *Database->GetLastError());
 	}
-	
-	return bSuccess;
 }
 
 void UDatabaseManager::SetActivePlayer(int32 PlayerID)
@@ -289,6 +916,13 @@ void UDatabaseManager::SetActivePlayer(int32 PlayerID)
 
 int32 UDatabaseManager::FindSessionPlayer(int32 HostPlayerID, const FString& PlayerName)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<int32>([this, HostPlayerID, &PlayerName]() {
+			return FindSessionPlayer(HostPlayerID, PlayerName);
+		});
+	}
+
 	if (!Database || !Database->IsValid())
 	{
 		return -1;
@@ -313,6 +947,13 @@ int32 UDatabaseManager::FindSessionPlayer(int32 HostPlayerID, const FString& Pla
 
 int32 UDatabaseManager::CreateSessionPlayer(int32 HostPlayerID, const FString& PlayerName)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<int32>([this, HostPlayerID, &PlayerName]() {
+			return CreateSessionPlayer(HostPlayerID, PlayerName);
+		});
+	}
+
 	if (!Database || !Database->IsValid())
 	{
 		return -1;
@@ -341,6 +982,11 @@ int32 UDatabaseManager::CreateSessionPlayer(int32 HostPlayerID, const FString& P
 
 TArray<int32> UDatabaseManager::GetSessionPlayers(int32 HostPlayerID)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<TArray<int32>>([this, HostPlayerID]() { return GetSessionPlayers(HostPlayerID); });
+	}
+
 	TArray<int32> PlayerIDs;
 	
 	if (!Database || !Database->IsValid())
@@ -348,20 +994,19 @@ TArray<int32> UDatabaseManager::GetSessionPlayers(int32 HostPlayerID)
 		return PlayerIDs;
 	}
 
-	FString Query = TEXT("SELECT PlayerID FROM Players WHERE HostPlayerID = ?");
-	FSQLitePreparedStatement Statement;
-	
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(TEXT("SELECT PlayerID FROM Players WHERE HostPlayerID = ?"));
+	if (!Statement)
 	{
 		return PlayerIDs;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
-	Statement.SetBindingValueByIndex(1, HostPlayerID);
+	Statement->SetBindingValueByIndex(1, HostPlayerID);
 
-	while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
 		int32 PlayerID;
-		Statement.GetColumnValueByIndex(0, PlayerID);
+		Statement->GetColumnValueByIndex(0, PlayerID);
 		PlayerIDs.Add(PlayerID);
 	}
 
@@ -371,6 +1016,11 @@ TArray<int32> UDatabaseManager::GetSessionPlayers(int32 HostPlayerID)
 
 bool UDatabaseManager::IsPlayerHost(int32 PlayerID)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, PlayerID]() { return IsPlayerHost(PlayerID); });
+	}
+
 	if (!Database || !Database->IsValid())
 	{
 		return false;
@@ -393,6 +1043,13 @@ bool UDatabaseManager::IsPlayerHost(int32 PlayerID)
 
 bool UDatabaseManager::SavePlayerMoney(int32 PlayerID, int32 TotalMoney)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, PlayerID, TotalMoney]() { return SavePlayerMoney(PlayerID, TotalMoney); });
+	}
+
+	DATABASE_OPERATION_SCOPE(SavePlayerMoney);
+
 	if (!Database || !Database->IsValid())
 	{
 		return false;
@@ -408,6 +1065,7 @@ bool UDatabaseManager::SavePlayerMoney(int32 PlayerID, int32 TotalMoney)
 
 	if (bSuccess)
 	{
+		OperationScope.SetRows(1);
 		UE_LOG(LogDatabase, Verbose, TEXT("💰 Saved player money: PlayerID=%d, Money=%d"), 
 			PlayerID, TotalMoney);
 	}
@@ -415,29 +1073,166 @@ bool UDatabaseManager::SavePlayerMoney(int32 PlayerID, int32 TotalMoney)
 	return bSuccess;
 }
 
+void UDatabaseManager::SavePlayerMoneyAsync(int32 PlayerID, int32 TotalMoney, TFunction<void(bool)> OnComplete)
+{
+	RunOnDatabaseThreadAsync<bool>(
+		[this, PlayerID, TotalMoney]() {
+			return SavePlayerMoney(PlayerID, TotalMoney);
+		},
+		[OnComplete = MoveTemp(OnComplete)](bool&& bSuccess) {
+			if (OnComplete)
+			{
+				OnComplete(bSuccess);
+			}
+		});
+}
+
+TArray<int32> UDatabaseManager::SaveSession(const TArray<FPlayerSaveSnapshot>& Snapshots)
+{
+	TArray<FCaughtFishRecord> Catches = TakePendingCatches();
+
+	return RunOnDatabaseThread<TArray<int32>>([this, &Snapshots, &Catches]() {
+		return WriteSessionSnapshots(Snapshots, Catches);
+	});
+}
+
+void UDatabaseManager::SaveSessionAsync(TArray<FPlayerSaveSnapshot> Snapshots,
+	TFunction<void(const TArray<int32>& FailedPlayerIDs)> OnComplete)
+{
+	RunOnDatabaseThreadAsync<TArray<int32>>(
+		[this, Snapshots = MoveTemp(Snapshots), Catches = TakePendingCatches()]() {
+			return WriteSessionSnapshots(Snapshots, Catches);
+		},
+		[OnComplete = MoveTemp(OnComplete)](TArray<int32>&& FailedPlayerIDs) {
+			if (OnComplete)
+			{
+				OnComplete(FailedPlayerIDs);
+			}
+		});
+}
+
+TArray<int32> UDatabaseManager::WriteSessionSnapshots(const TArray<FPlayerSaveSnapshot>& Snapshots,
+	const TArray<FCaughtFishRecord>& Catches)
+{
+	DATABASE_OPERATION_SCOPE(SaveSession);
+
+	TArray<int32> FailedPlayerIDs;
+
+	if (!Database || !Database->IsValid() || !BeginTransaction())
+	{
+		RequeueCaughtFish(Catches);
+		for (const FPlayerSaveSnapshot& Snapshot : Snapshots)
+		{
+			FailedPlayerIDs.Add(Snapshot.PlayerID);
+		}
+		return FailedPlayerIDs;
+	}
+
+	if (Catches.Num() > 0 && WriteCaughtFishBatch(Catches) == INDEX_NONE)
+	{
+		RequeueCaughtFish(Catches);
+		for (const FPlayerSaveSnapshot& Snapshot : Snapshots)
+		{
+			const bool bHasCatches = Catches.ContainsByPredicate([&Snapshot](const FCaughtFishRecord& Record) {
+				return Record.PlayerID == Snapshot.PlayerID;
+			});
+			if (bHasCatches)
+			{
+				FailedPlayerIDs.Add(Snapshot.PlayerID);
+			}
+		}
+	}
+
+	for (const FPlayerSaveSnapshot& Snapshot : Snapshots)
+	{
+		if (!BeginSavepoint(TEXT("player_save")))
+		{
+			FailedPlayerIDs.AddUnique(Snapshot.PlayerID);
+			continue;
+		}
+
+		if (WritePlayerSnapshot(Snapshot))
+		{
+			ReleaseSavepoint(TEXT("player_save"));
+		}
+		else
+		{
+			UE_LOG(LogDatabase, Error, TEXT("❌ Session save rolled back PlayerID=%d"), Snapshot.PlayerID);
+			RollbackToSavepoint(TEXT("player_save"));
+			FailedPlayerIDs.AddUnique(Snapshot.PlayerID);
+		}
+	}
+
+	if (!CommitTransaction())
+	{
+		UE_LOG(LogDatabase, Error, TEXT("❌ Session save commit failed: %s"), *Database->GetLastError());
+		RollbackTransaction();
+		RequeueCaughtFish(Catches);
+
+		FailedPlayerIDs.Reset();
+		for (const FPlayerSaveSnapshot& Snapshot : Snapshots)
+		{
+			FailedPlayerIDs.Add(Snapshot.PlayerID);
+		}
+		return FailedPlayerIDs;
+	}
+
+	OperationScope.SetRows(Snapshots.Num() - FailedPlayerIDs.Num());
+	UE_LOG(LogDatabase, Log, TEXT("✅ Saved session: Players=%d, Failed=%d, Catches=%d"),
+		Snapshots.Num(), FailedPlayerIDs.Num(), Catches.Num());
+	return FailedPlayerIDs;
+}
+
+bool UDatabaseManager::WritePlayerSnapshot(const FPlayerSaveSnapshot& Snapshot)
+{
+	if (!SavePlayerMoney(Snapshot.PlayerID, Snapshot.TotalMoney))
+	{
+		return false;
+	}
+
+	const TArray<FInventoryItemRecord> Records = BuildInventoryRecords(Snapshot.Inventory);
+
+	if (Snapshot.bFullInventory)
+	{
+		return WriteInventoryRecords(Snapshot.PlayerID, Records);
+	}
+
+	return WriteInventoryChanges(Snapshot.PlayerID, Records, Snapshot.RemovedItemGuids);
+}
+
 bool UDatabaseManager::LoadPlayerData(int32 PlayerID, FString& OutPlayerName, FString& OutVillageName, int32& OutMoney)
 {
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, PlayerID, &OutPlayerName, &OutVillageName, &OutMoney]() {
+			return LoadPlayerData(PlayerID, OutPlayerName, OutVillageName, OutMoney);
+		});
+	}
+
+	DATABASE_OPERATION_SCOPE(LoadPlayerData);
+
 	if (!Database || !Database->IsValid())
 	{
 		return false;
 	}
 	
-	FString Query = TEXT("SELECT PlayerName, VillageName, TotalMoney FROM Players WHERE PlayerID = ?");
-	FSQLitePreparedStatement Statement;
-	
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(
+		TEXT("SELECT PlayerName, VillageName, TotalMoney FROM Players WHERE PlayerID = ?"));
+	if (!Statement)
 	{
 		return false;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 	
-	Statement.SetBindingValueByIndex(1, PlayerID);
+	Statement->SetBindingValueByIndex(1, PlayerID);
 
-	if (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	if (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
-		Statement.GetColumnValueByIndex(0, OutPlayerName);
-		Statement.GetColumnValueByIndex(1, OutVillageName);
-		Statement.GetColumnValueByIndex(2, OutMoney);
+		Statement->GetColumnValueByIndex(0, OutPlayerName);
+		Statement->GetColumnValueByIndex(1, OutVillageName);
+		Statement->GetColumnValueByIndex(2, OutMoney);
 
+		OperationScope.SetRows(1);
 		UE_LOG(LogDatabase, Log, TEXT("✅ Loaded player: %s (%s), Money=%d"), 
 			*OutPlayerName, *OutVillageName, OutMoney);
 		return true;
@@ -453,31 +1248,453 @@ bool UDatabaseManager::LoadPlayerData(int32 PlayerID, FString& OutPlayerName, FS
 
 bool UDatabaseManager::SaveInventory(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ItemsWithPositions)
 {
+    const FInventorySnapshot Snapshot = CaptureInventorySnapshot(ItemsWithPositions);
+
+    return RunOnDatabaseThread<bool>([this, PlayerID, &Snapshot]() {
+        return WriteInventoryRecords(PlayerID, BuildInventoryRecords(Snapshot));
+    });
+}
+
+void UDatabaseManager::SaveInventoryAsync(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ItemsWithPositions,
+    TFunction<void(bool)> OnComplete)
+{
+    RunOnDatabaseThreadAsync<bool>(
+        [this, PlayerID, Snapshot = CaptureInventorySnapshot(ItemsWithPositions)]() {
+            return WriteInventoryRecords(PlayerID, BuildInventoryRecords(Snapshot));
+        },
+        [OnComplete = MoveTemp(OnComplete)](bool&& bSuccess) {
+            if (OnComplete)
+            {
+                OnComplete(bSuccess);
+            }
+        });
+}
+
+bool UDatabaseManager::SaveInventoryChanges(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ChangedItems,
+    const TArray<FGuid>& RemovedItemGuids)
+{
+    const FInventorySnapshot Snapshot = CaptureInventorySnapshot(ChangedItems);
+
+    return RunOnDatabaseThread<bool>([this, PlayerID, &Snapshot, &RemovedItemGuids]() {
+        return WriteInventoryChanges(PlayerID, BuildInventoryRecords(Snapshot), RemovedItemGuids);
+    });
+}
+
+void UDatabaseManager::SaveInventoryChangesAsync(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ChangedItems,
+    const TArray<FGuid>& RemovedItemGuids, TFunction<void(bool)> OnComplete)
+{
+    RunOnDatabaseThreadAsync<bool>(
+        [this, PlayerID, Snapshot = CaptureInventorySnapshot(ChangedItems), RemovedItemGuids]() {
+            return WriteInventoryChanges(PlayerID, BuildInventoryRecords(Snapshot), RemovedItemGuids);
+        },
+        [OnComplete = MoveTemp(OnComplete)](bool&& bSuccess) {
+            if (OnComplete)
+            {
+                OnComplete(bSuccess);
+            }
+        });
+}
+
+TMap<UItemBase*, FIntPoint> UDatabaseManager::LoadInventory(int32 PlayerID, UObject* Outer)
+{
+    if (!Outer)
+    {
+        return TMap<UItemBase*, FIntPoint>();
+    }
+
+    TArray<FInventoryItemRecord> Records = RunOnDatabaseThread<TArray<FInventoryItemRecord>>([this, PlayerID]() {
+        return ReadInventoryRecords(PlayerID);
+    });
+
+    return CreateItemsFromRecords(Records, Outer);
+}
+
+void UDatabaseManager::LoadInventoryAsync(int32 PlayerID, UObject* Outer,
+    TFunction<void(const TMap<UItemBase*, FIntPoint>&)> OnComplete)
+{
+    TWeakObjectPtr<UObject> WeakOuter(Outer);
+
+    RunOnDatabaseThreadAsync<TArray<FInventoryItemRecord>>(
+        [this, PlayerID]() {
+            return ReadInventoryRecords(PlayerID);
+        },
+        [this, WeakOuter, OnComplete = MoveTemp(OnComplete)](TArray<FInventoryItemRecord>&& Records) mutable {
+            UItemAssetSubsystem* AssetSubsystem = GetGameInstance()->GetSubsystem<UItemAssetSubsystem>();
+            if (!AssetSubsystem)
+            {
+                if (UObject* Outer = WeakOuter.Get(); Outer && OnComplete)
+                {
+                    OnComplete(CreateItemsFromRecords(Records, Outer));
+                }
+                return;
+            }
+
+            TArray<FSoftObjectPath> AssetPaths;
+            AssetPaths.Reserve(Records.Num());
+            for (const FInventoryItemRecord& Record : Records)
+            {
+                AssetPaths.AddUnique(FSoftObjectPath(Record.ItemDataProviderPath));
+            }
+
+            AssetSubsystem->LoadAssetsAsync(AssetPaths,
+                [WeakThis = TWeakObjectPtr<UDatabaseManager>(this), WeakOuter, Records = MoveTemp(Records),
+                    OnComplete = MoveTemp(OnComplete)]() {
+                    UObject* Outer = WeakOuter.Get();
+                    if (!WeakThis.IsValid() || !Outer || !OnComplete)
+                    {
+                        return;
+                    }
+                    OnComplete(WeakThis->CreateItemsFromRecords(Records, Outer));
+                });
+        });
+}
+
+bool UDatabaseManager::WriteInventoryRecords(int32 PlayerID, const TArray<FInventoryItemRecord>& Records)
+{
+    DATABASE_OPERATION_SCOPE(SaveInventory);
+
+    if (!Database || !Database->IsValid())
+    {
+        return false;
+    }
+
+    if (!BeginSavepoint(TEXT("inventory_save")))
+    {
+        return false;
+    }
+
+    if (!ExecutePreparedQuery(TEXT("DELETE FROM InventoryItems WHERE PlayerID = ?"),
+        [PlayerID](FSQLitePreparedStatement& Stmt) {
+            Stmt.SetBindingValueByIndex(1, PlayerID);
+        }))
+    {
+        RollbackToSavepoint(TEXT("inventory_save"));
+        return false;
+    }
+
+    if (!InsertInventoryRecords(PlayerID, Records, true))
+    {
+        RollbackToSavepoint(TEXT("inventory_save"));
+        return false;
+    }
+
+    ReleaseSavepoint(TEXT("inventory_save"));
+    OperationScope.SetRows(Records.Num());
+    UE_LOG(LogDatabase, Log, TEXT("✅ Saved inventory: PlayerID=%d, Items=%d"), 
+        PlayerID, Records.Num());
+    return true;
+}
+
+bool UDatabaseManager::WriteInventoryChanges(int32 PlayerID, const TArray<FInventoryItemRecord>& ChangedRecords,
+    const TArray<FGuid>& RemovedItemGuids)
+{
+    DATABASE_OPERATION_SCOPE(SaveInventoryChanges);
+
     if (!Database || !Database->IsValid())
     {
         return false;
     }
 
-    if (!BeginTransaction())
+    if (ChangedRecords.Num() == 0 && RemovedItemGuids.Num() == 0)
+    {
+        return true;
+    }
+
+    if (!BeginSavepoint(TEXT("inventory_save")))
     {
         return false;
     }
 
-    if (!ExecuteQuery(FString::Printf(TEXT("DELETE FROM InventoryItems WHERE PlayerID = %d"), PlayerID)))
+    for (const FGuid& ItemGuid : RemovedItemGuids)
+    {
+        if (!ExecutePreparedQuery(TEXT("DELETE FROM InventoryItems WHERE PlayerID = ? AND ItemGuid = ?"),
+            [PlayerID, &ItemGuid](FSQLitePreparedStatement& Stmt) {
+                Stmt.SetBindingValueByIndex(1, PlayerID);
+                Stmt.SetBindingValueByIndex(2, ItemGuid.ToString());
+            }))
+        {
+            RollbackToSavepoint(TEXT("inventory_save"));
+            return false;
+        }
+    }
+
+    const FString UpsertQuery = BuildInventoryInsertQuery(1) + TEXT(
+        " ON CONFLICT(ItemGuid) DO UPDATE SET "
+        "PlayerID = excluded.PlayerID, "
+        "DefinitionID = excluded.DefinitionID, "
+        "GridX = excluded.GridX, "
+        "GridY = excluded.GridY, "
+        "bIsRotated = excluded.bIsRotated, "
+        "SpecificData = excluded.SpecificData");
+
+    for (const FInventoryItemRecord& Record : ChangedRecords)
+    {
+        const int32 DefinitionID = FindOrCreateItemDefinition(Record.ItemDataProviderPath, Record.ItemCategory);
+        if (DefinitionID == INDEX_NONE || !ExecutePreparedQuery(UpsertQuery, [PlayerID, DefinitionID, &Record](FSQLitePreparedStatement& Stmt) {
+            BindInventoryRecord(Stmt, 0, PlayerID, DefinitionID, Record);
+        }))
+        {
+            RollbackToSavepoint(TEXT("inventory_save"));
+            return false;
+        }
+    }
+
+    ReleaseSavepoint(TEXT("inventory_save"));
+    OperationScope.SetRows(ChangedRecords.Num() + RemovedItemGuids.Num());
+    UE_LOG(LogDatabase, Log, TEXT("✅ Saved inventory changes: PlayerID=%d, Upserted=%d, Removed=%d"),
+        PlayerID, ChangedRecords.Num(), RemovedItemGuids.Num());
+    return true;
+}
+
+bool UDatabaseManager::InsertInventoryRecords(int32 PlayerID, const TArray<FInventoryItemRecord>& Records, bool bBatched)
+{
+    TArray<int32> DefinitionIDs;
+    DefinitionIDs.Reserve(Records.Num());
+    for (const FInventoryItemRecord& Record : Records)
+    {
+        const int32 DefinitionID = FindOrCreateItemDefinition(Record.ItemDataProviderPath, Record.ItemCategory);
+        if (DefinitionID == INDEX_NONE)
+        {
+            return false;
+        }
+        DefinitionIDs.Add(DefinitionID);
+    }
+
+    int32 RecordIndex = 0;
+
+    if (bBatched && Records.Num() >= InventoryInsertBatchSize)
+    {
+        FSQLitePreparedStatement* BatchStatement = GetCachedStatement(BuildInventoryInsertQuery(InventoryInsertBatchSize));
+        if (!BatchStatement)
+        {
+            return false;
+        }
+        ON_SCOPE_EXIT { BatchStatement->Reset(); };
+
+        for (; RecordIndex + InventoryInsertBatchSize <= Records.Num(); RecordIndex += InventoryInsertBatchSize)
+        {
+            BatchStatement->Reset();
+            BatchStatement->ClearBindings();
+
+            for (int32 Row = 0; Row < InventoryInsertBatchSize; Row++)
+            {
+                BindInventoryRecord(*BatchStatement, Row, PlayerID, DefinitionIDs[RecordIndex + Row], Records[RecordIndex + Row]);
+            }
+
+            if (!BatchStatement->Execute())
+            {
+                UE_LOG(LogDatabase, Error, TEXT("Batched inventory insert failed: %s"), *Database->GetLastError());
+                return false;
+            }
+        }
+    }
+
+    if (RecordIndex >= Records.Num())
+    {
+        return true;
+    }
+
+    FSQLitePreparedStatement* RowStatement = GetCachedStatement(BuildInventoryInsertQuery(1));
+    if (!RowStatement)
     {
-        RollbackTransaction();
         return false;
     }
+    ON_SCOPE_EXIT { RowStatement->Reset(); };
+
+    for (; RecordIndex < Records.Num(); RecordIndex++)
+    {
+        RowStatement->Reset();
+        RowStatement->ClearBindings();
+        BindInventoryRecord(*RowStatement, 0, PlayerID, DefinitionIDs[RecordIndex], Records[RecordIndex]);
+
+        if (!RowStatement->Execute())
+        {
+            UE_LOG(LogDatabase, Error, TEXT("Inventory insert failed: %s"), *Database->GetLastError());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void UDatabaseManager::BenchmarkInventoryInserts(const TArray<int32>& ItemCounts)
+{
+    if (!IsInDatabaseThread())
+    {
+        RunOnDatabaseThread<bool>([this, &ItemCounts]() { BenchmarkInventoryInserts(ItemCounts); return true; });
+        return;
+    }
+
+    if (!Database || !Database->IsValid())
+    {
+        UE_LOG(LogDatabase, Warning, TEXT("BenchmarkInventoryInserts: Database not open"));
+        return;
+    }
+
+    constexpr int32 BenchmarkPlayerID = -1;
+    constexpr int32 Iterations = 5;
+
+    FItemSpecificData BenchmarkData;
+    FFishSpecificData BenchmarkFish;
+    BenchmarkFish.ActualLength = 42.5f;
+    BenchmarkFish.ActualWeight = 1200.0f;
+    BenchmarkFish.FishDataName = TEXT("BenchmarkFish");
+    BenchmarkData.SetFishData(BenchmarkFish);
+    const TArray<uint8> BenchmarkSpecificData = SerializeSpecificData(BenchmarkData);
+
+    const FString RowInsertQuery = BuildInventoryInsertQuery(1);
+
+    auto InsertUncached = [this, &RowInsertQuery](const TArray<FInventoryItemRecord>& Records) -> bool
+    {
+        for (const FInventoryItemRecord& Record : Records)
+        {
+            const int32 DefinitionID = FindOrCreateItemDefinition(Record.ItemDataProviderPath, Record.ItemCategory);
+            if (DefinitionID == INDEX_NONE)
+            {
+                return false;
+            }
+
+            FSQLitePreparedStatement Statement;
+            if (!Statement.Create(*Database, *RowInsertQuery))
+            {
+                return false;
+            }
+
+            BindInventoryRecord(Statement, 0, BenchmarkPlayerID, DefinitionID, Record);
+            const bool bInserted = Statement.Execute();
+            Statement.Destroy();
+
+            if (!bInserted)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto TimeInsert = [this](const TArray<FInventoryItemRecord>& Records,
+        TFunctionRef<bool(const TArray<FInventoryItemRecord>&)> Insert) -> double
+    {
+        double TotalSeconds = 0.0;
+        for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+        {
+            if (!BeginTransaction())
+            {
+                return -1.0;
+            }
+            ExecuteQuery(TEXT("PRAGMA defer_foreign_keys = ON"));
+
+            const double StartTime = FPlatformTime::Seconds();
+            const bool bSuccess = Insert(Records);
+            TotalSeconds += FPlatformTime::Seconds() - StartTime;
+
+            RollbackTransaction();
+
+            if (!bSuccess)
+            {
+                return -1.0;
+            }
+        }
+        return TotalSeconds * 1000.0 / Iterations;
+    };
+
+    UE_LOG(LogDatabase, Log, TEXT("=== BenchmarkInventoryInserts (BatchSize=%d, Iterations=%d) ==="),
+        InventoryInsertBatchSize, Iterations);
+
+    for (int32 ItemCount : ItemCounts)
+    {
+        TArray<FInventoryItemRecord> Records;
+        Records.Reserve(ItemCount);
+        for (int32 i = 0; i < ItemCount; i++)
+        {
+            FInventoryItemRecord& Record = Records.AddDefaulted_GetRef();
+            Record.ItemGuid = FGuid::NewGuid().ToString();
+            Record.ItemDataProviderPath = TEXT("/Game/Benchmark/DA_BenchmarkFish.DA_BenchmarkFish");
+            Record.ItemCategory = TEXT("Fish");
+            Record.GridPosition = FIntPoint(i % 10, i / 10);
+            Record.bIsRotated = (i % 2) == 0;
+            Record.SpecificData = BenchmarkSpecificData;
+        }
+
+        const double UncachedMs = TimeInsert(Records, InsertUncached);
+        const double PerRowMs = TimeInsert(Records, [this](const TArray<FInventoryItemRecord>& Rows) {
+            return InsertInventoryRecords(BenchmarkPlayerID, Rows, false);
+        });
+        const double BatchedMs = TimeInsert(Records, [this](const TArray<FInventoryItemRecord>& Rows) {
+            return InsertInventoryRecords(BenchmarkPlayerID, Rows, true);
+        });
+
+        UE_LOG(LogDatabase, Log,
+            TEXT("Items=%5d | Uncached=%8.3f ms | PerRow=%8.3f ms | Batched=%8.3f ms | Speedup=%.2fx"),
+            ItemCount, UncachedMs, PerRowMs, BatchedMs, BatchedMs > 0.0 ? UncachedMs / BatchedMs : 0.0);
+    }
+}
+
+TArray<FInventoryItemRecord> UDatabaseManager::ReadInventoryRecords(int32 PlayerID)
+{
+    DATABASE_OPERATION_SCOPE(LoadInventory);
+
+    TArray<FInventoryItemRecord> Records;
+
+    if (!Database || !Database->IsValid())
+    {
+        return Records;
+    }
 
-    FString InsertQuery = TEXT(
-        "INSERT INTO InventoryItems (PlayerID, ItemGuid, ItemDataProviderPath, ItemCategory, "
-        "GridX, GridY, bIsRotated, SpecificDataJSON) VALUES (?, ?, ?, ?, ?, ?, ?, ?)"
+    FString Query = TEXT(
+        "SELECT ItemGuid, DefinitionID, GridX, GridY, "
+        "bIsRotated, SpecificData FROM InventoryItems WHERE PlayerID = ?"
     );
 
+    FSQLitePreparedStatement* Statement = GetCachedStatement(Query);
+    if (!Statement)
+    {
+        return Records;
+    }
+    ON_SCOPE_EXIT { Statement->Reset(); };
+
+    Statement->SetBindingValueByIndex(1, PlayerID);
+
+    while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
+    {
+        FInventoryItemRecord& Record = Records.AddDefaulted_GetRef();
+        int32 DefinitionID = INDEX_NONE;
+        int32 bIsRotatedInt = 0;
+
+        Statement->GetColumnValueByIndex(0, Record.ItemGuid);
+        Statement->GetColumnValueByIndex(1, DefinitionID);
+        Statement->GetColumnValueByIndex(2, Record.GridPosition.X);
+        Statement->GetColumnValueByIndex(3, Record.GridPosition.Y);
+        Statement->GetColumnValueByIndex(4, bIsRotatedInt);
+        Statement->GetColumnValueByIndex(5, Record.SpecificData);
+
+        Record.bIsRotated = (bIsRotatedInt != 0);
+
+        if (const FItemDefinition* Definition = ItemDefinitions.Find(DefinitionID))
+        {
+            Record.ItemDataProviderPath = Definition->AssetPath;
+            Record.ItemCategory = Definition->Category;
+        }
+        else
+        {
+            UE_LOG(LogDatabase, Warning, TEXT("Unknown item definition %d for item %s"), DefinitionID, *Record.ItemGuid);
+        }
+    }
+
+    OperationScope.SetRows(Records.Num());
+    return Records;
+}
+
+FInventorySnapshot UDatabaseManager::CaptureInventorySnapshot(const TMap<UItemBase*, FIntPoint>& ItemsWithPositions)
+{
+    FInventorySnapshot Snapshot;
+    Snapshot.Items.Reserve(ItemsWithPositions.Num());
+
+    TMap<const UObject*, int32> DefinitionIndices;
+
     for (const auto& Pair : ItemsWithPositions)
     {
         const UItemBase* Item = Pair.Key;
-        const FIntPoint& GridPos = Pair.Value;
 
         if (!Item || !Item->ItemDataProvider.GetObject())
         {
@@ -485,180 +1702,365 @@ bool UDatabaseManager::SaveInventory(int32 PlayerID, const TMap<UItemBase*, FInt
         }
 
         UObject* DataProviderObj = Item->ItemDataProvider.GetObject();
-        FString ItemPath = DataProviderObj->GetPathName();
-        EItemCategory Category = IItemDataProvider::Execute_GetCategory(DataProviderObj);
-        FString CategoryStr = StaticEnum<EItemCategory>()->GetNameStringByValue((int64)Category);
-        FString SpecificDataJSON = SerializeSpecificData(Item->SpecificData);
+        int32 DefinitionIndex = INDEX_NONE;
+        if (const int32* ExistingIndex = DefinitionIndices.Find(DataProviderObj))
+        {
+            DefinitionIndex = *ExistingIndex;
+        }
+        else
+        {
+            EItemCategory Category = IItemDataProvider::Execute_GetCategory(DataProviderObj);
+            DefinitionIndex = Snapshot.Definitions.Add(FItemDefinition{
+                DataProviderObj->GetPathName(),
+                StaticEnum<EItemCategory>()->GetNameStringByValue((int64)Category) });
+            DefinitionIndices.Add(DataProviderObj, DefinitionIndex);
+        }
 
-        if (!ExecutePreparedQuery(InsertQuery, [&](FSQLitePreparedStatement& Stmt) {
-            Stmt.SetBindingValueByIndex(1, PlayerID);
-            Stmt.SetBindingValueByIndex(2, Item->ItemGuid.ToString());
-            Stmt.SetBindingValueByIndex(3, ItemPath);
-            Stmt.SetBindingValueByIndex(4, CategoryStr);
-            Stmt.SetBindingValueByIndex(5, GridPos.X);
-            Stmt.SetBindingValueByIndex(6, GridPos.Y);
-            Stmt.SetBindingValueByIndex(7, Item->bIsRotated ? 1 : 0);
-            Stmt.SetBindingValueByIndex(8, SpecificDataJSON);
-        }))
+        FInventoryItemSnapshot& ItemSnapshot = Snapshot.Items.AddDefaulted_GetRef();
+        ItemSnapshot.ItemGuid = Item->ItemGuid;
+        ItemSnapshot.DefinitionIndex = DefinitionIndex;
+        ItemSnapshot.GridPosition = Pair.Value;
+        ItemSnapshot.bIsRotated = Item->bIsRotated;
+        ItemSnapshot.SpecificData = Item->SpecificData;
+    }
+
+    return Snapshot;
+}
+
+TArray<FInventoryItemRecord> UDatabaseManager::BuildInventoryRecords(const FInventorySnapshot& Snapshot)
+{
+    TArray<FInventoryItemRecord> Records;
+    Records.Reserve(Snapshot.Items.Num());
+
+    for (const FInventoryItemSnapshot& Item : Snapshot.Items)
+    {
+        const FItemDefinition& Definition = Snapshot.Definitions[Item.DefinitionIndex];
+
+        FInventoryItemRecord& Record = Records.AddDefaulted_GetRef();
+        Record.ItemGuid = Item.ItemGuid.ToString();
+        Record.ItemDataProviderPath = Definition.AssetPath;
+        Record.ItemCategory = Definition.Category;
+        Record.GridPosition = Item.GridPosition;
+        Record.bIsRotated = Item.bIsRotated;
+        Record.SpecificData = SerializeSpecificData(Item.SpecificData);
+    }
+
+    return Records;
+}
+
+TMap<UItemBase*, FIntPoint> UDatabaseManager::CreateItemsFromRecords(const TArray<FInventoryItemRecord>& Records, UObject* Outer)
+{
+    TMap<UItemBase*, FIntPoint> ItemsWithPositions;
+    UItemAssetSubsystem* AssetSubsystem = GetGameInstance()->GetSubsystem<UItemAssetSubsystem>();
+
+    for (const FInventoryItemRecord& Record : Records)
+    {
+        const FSoftObjectPath AssetPath(Record.ItemDataProviderPath);
+        UObject* LoadedAsset = AssetSubsystem ? AssetSubsystem->LoadAssetSync(AssetPath) : AssetPath.TryLoad();
+        
+        if (!LoadedAsset || !LoadedAsset->Implements<UItemDataProvider>())
         {
-            RollbackTransaction();
-            return false;
+            UE_LOG(LogDatabase, Warning, TEXT("Failed to load: %s"), *Record.ItemDataProviderPath);
+            continue;
+        }
+
+        UItemBase* NewItem = NewObject<UItemBase>(Outer);
+        if (NewItem)
+        {
+            FGuid::Parse(Record.ItemGuid, NewItem->ItemGuid);
+            NewItem->ItemDataProvider.SetObject(LoadedAsset);
+            NewItem->ItemDataProvider.SetInterface(Cast<IItemDataProvider>(LoadedAsset));
+            NewItem->bIsRotated = Record.bIsRotated;
+            DeserializeSpecificData(Record.SpecificData, NewItem->SpecificData);
+            
+            ItemsWithPositions.Add(NewItem, Record.GridPosition);
         }
     }
 
-    CommitTransaction();
-    UE_LOG(LogDatabase, Log, TEXT("✅ Saved inventory: PlayerID=%d, Items=%d"), 
-        PlayerID, ItemsWithPositions.Num());
-    return true;
+    UE_LOG(LogDatabase, Log, TEXT("✅ Loaded inventory: Items=%d"), ItemsWithPositions.Num());
+    return ItemsWithPositions;
+}
+
+bool UDatabaseManager::ClearInventory(int32 PlayerID)
+{
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, PlayerID]() { return ClearInventory(PlayerID); });
+	}
+
+	bool bSuccess = ExecutePreparedQuery(
+		TEXT("DELETE FROM InventoryItems WHERE PlayerID = ?"),
+		[PlayerID](FSQLitePreparedStatement& Stmt) {
+			Stmt.SetBindingValueByIndex(1, PlayerID);
+		});
+    
+	if (bSuccess)
+	{
+		UE_LOG(LogDatabase, Log, TEXT("✅ Cleared inventory: PlayerID=%d"), PlayerID);
+	}
+    
+	return bSuccess;
+}
+
+
+
+
+
+bool UDatabaseManager::RecordCaughtFish(int32 PlayerID, const FString& FishDataPath, 
+	const FString& FishName, float Length, float Weight)
+{
+	if (!IsInDatabaseThread())
+	{
+		return RunOnDatabaseThread<bool>([this, PlayerID, &FishDataPath, &FishName, Length, Weight]() {
+			return RecordCaughtFish(PlayerID, FishDataPath, FishName, Length, Weight);
+		});
+	}
+
+	if (!Database || !Database->IsValid())
+	{
+		return false;
+	}
+
+	FCaughtFishRecord Record;
+	Record.PlayerID = PlayerID;
+	Record.FishDataPath = FishDataPath;
+	Record.FishName = FishName;
+	Record.Length = Length;
+	Record.Weight = Weight;
+	Record.CaughtAt = GetCurrentTimestamp();
+
+	return WriteCaughtFishBatch({ Record }) == 1;
+}
+
+void UDatabaseManager::QueueCaughtFish(int32 PlayerID, const FString& FishDataPath,
+	const FString& FishName, float Length, float Weight)
+{
+	if (PlayerID <= 0)
+	{
+		UE_LOG(LogDatabase, Warning, TEXT("❌ Ignored caught fish %s: invalid PlayerID=%d"), *FishName, PlayerID);
+		return;
+	}
+
+	FCaughtFishRecord& Record = PendingCatches.AddDefaulted_GetRef();
+	Record.PlayerID = PlayerID;
+	Record.FishDataPath = FishDataPath;
+	Record.FishName = FishName;
+	Record.Length = Length;
+	Record.Weight = Weight;
+	Record.CaughtAt = GetCurrentTimestamp();
+	bCatchesSinceLastRead = true;
+
+	if (PendingCatches.Num() >= MaxPendingCatches)
+	{
+		FlushCaughtFish();
+	}
 }
 
-TMap<UItemBase*, FIntPoint> UDatabaseManager::LoadInventory(int32 PlayerID, UObject* Outer)
+bool UDatabaseManager::ConsumeUnreadCatches()
 {
-    TMap<UItemBase*, FIntPoint> ItemsWithPositions;
+	const bool bUnread = bCatchesSinceLastRead || PendingCatches.Num() > 0;
+	bCatchesSinceLastRead = false;
+	return bUnread;
+}
 
-    if (!Database || !Database->IsValid() || !Outer)
-    {
-        return ItemsWithPositions;
-    }
+void UDatabaseManager::FlushCaughtFish()
+{
+	if (PendingCatches.Num() == 0)
+	{
+		return;
+	}
 
-    FString Query = TEXT(
-        "SELECT ItemGuid, ItemDataProviderPath, ItemCategory, GridX, GridY, "
-        "bIsRotated, SpecificDataJSON FROM InventoryItems WHERE PlayerID = ?"
-    );
+	TArray<FCaughtFishRecord> Batch = TakePendingCatches();
 
-    FSQLitePreparedStatement Statement;
-    if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
-    {
-        return ItemsWithPositions;
-    }
+	if (!DatabaseWorker)
+	{
+		if (WriteCaughtFishBatch(Batch) == INDEX_NONE)
+		{
+			RequeueCaughtFish(MoveTemp(Batch));
+		}
+		return;
+	}
 
-    Statement.SetBindingValueByIndex(1, PlayerID);
+	DatabaseWorker->Enqueue([this, Batch = MoveTemp(Batch)]() mutable {
+		if (WriteCaughtFishBatch(Batch) == INDEX_NONE)
+		{
+			RequeueCaughtFish(MoveTemp(Batch));
+		}
+	});
+}
 
-    while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
-    {
-        FString ItemGuidStr, ItemPath, Category, SpecificDataJSON;
-        int32 GridX, GridY, bIsRotatedInt;
+TArray<FCaughtFishRecord> UDatabaseManager::TakePendingCatches()
+{
+	TArray<FCaughtFishRecord> Batch = MoveTemp(PendingCatches);
+	PendingCatches.Reset();
+	PendingCatches.Reserve(MaxPendingCatches);
+	return Batch;
+}
 
-        Statement.GetColumnValueByIndex(0, ItemGuidStr);
-        Statement.GetColumnValueByIndex(1, ItemPath);
-        Statement.GetColumnValueByIndex(2, Category);
-        Statement.GetColumnValueByIndex(3, GridX);
-        Statement.GetColumnValueByIndex(4, GridY);
-        Statement.GetColumnValueByIndex(5, bIsRotatedInt);
-        Statement.GetColumnValueByIndex(6, SpecificDataJSON);
+void UDatabaseManager::RequeueCaughtFish(TArray<FCaughtFishRecord> Records)
+{
+	if (Records.Num() == 0)
+	{
+		return;
+	}
 
-        TSoftObjectPtr<UObject> ItemDataAsset{FSoftObjectPath(ItemPath)};
-        UObject* LoadedAsset = ItemDataAsset.LoadSynchronous();
-        
-        if (!LoadedAsset || !LoadedAsset->Implements<UItemDataProvider>())
-        {
-            UE_LOG(LogDatabase, Warning, TEXT("Failed to load: %s"), *ItemPath);
-            continue;
-        }
+	if (bShuttingDown)
+	{
+		LogUnwrittenCatches(Records, TEXT("database shutting down"));
+		return;
+	}
 
-        UItemBase* NewItem = NewObject<UItemBase>(Outer);
-        if (NewItem)
-        {
-            FGuid::Parse(ItemGuidStr, NewItem->ItemGuid);
-            NewItem->ItemDataProvider.SetObject(LoadedAsset);
-            NewItem->ItemDataProvider.SetInterface(Cast<IItemDataProvider>(LoadedAsset));
-            NewItem->bIsRotated = (bIsRotatedInt != 0);
-            DeserializeSpecificData(SpecificDataJSON, NewItem->SpecificData);
-            
-            ItemsWithPositions.Add(NewItem, FIntPoint(GridX, GridY));
-        }
-    }
+	if (!IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread,
+			[WeakThis = TWeakObjectPtr<UDatabaseManager>(this), Records = MoveTemp(Records)]() mutable
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->RequeueCaughtFish(MoveTemp(Records));
+				}
+				else
+				{
+					LogUnwrittenCatches(Records, TEXT("database manager destroyed"));
+				}
+			});
+		return;
+	}
 
-    UE_LOG(LogDatabase, Log, TEXT("✅ Loaded inventory: PlayerID=%d, Items=%d"), 
-        PlayerID, ItemsWithPositions.Num());
-    return ItemsWithPositions;
+	PendingCatches.Insert(Records, 0);
+	UE_LOG(LogDatabase, Warning, TEXT("❌ Re-queued %d caught fish for retry (Pending: %d)"),
+		Records.Num(), PendingCatches.Num());
+
+	const int32 Overflow = PendingCatches.Num() - MaxQueuedCatches;
+	if (Overflow > 0)
+	{
+		TArray<FCaughtFishRecord> Dropped(PendingCatches.GetData(), Overflow);
+		PendingCatches.RemoveAt(0, Overflow);
+		LogUnwrittenCatches(Dropped, TEXT("catch queue full, dropped oldest"));
+	}
 }
 
-bool UDatabaseManager::ClearInventory(int32 PlayerID)
+bool UDatabaseManager::TickCatchLog(float DeltaTime)
 {
-	bool bSuccess = ExecuteQuery(
-		FString::Printf(TEXT("DELETE FROM InventoryItems WHERE PlayerID = %d"), PlayerID)
-	);
-    
-	if (bSuccess)
+	FlushCaughtFish();
+	UpdateStorageStats();
+	return true;
+}
+
+int32 UDatabaseManager::WriteCaughtFishBatch(const TArray<FCaughtFishRecord>& Records)
+{
+	DATABASE_OPERATION_SCOPE(RecordCaughtFish);
+
+	if (!Database || !Database->IsValid())
 	{
-		UE_LOG(LogDatabase, Log, TEXT("✅ Cleared inventory: PlayerID=%d"), PlayerID);
+		UE_LOG(LogDatabase, Error, TEXT("❌ Deferred %d caught fish: database not open"), Records.Num());
+		return INDEX_NONE;
 	}
-    
-	return bSuccess;
-}
 
+	if (!BeginSavepoint(TEXT("catch_log")))
+	{
+		UE_LOG(LogDatabase, Error, TEXT("❌ Deferred %d caught fish: %s"), Records.Num(), *Database->GetLastError());
+		return INDEX_NONE;
+	}
 
+	int32 RecordedCount = 0;
+	for (const FCaughtFishRecord& Record : Records)
+	{
+		if (!BeginSavepoint(TEXT("catch_record")))
+		{
+			RollbackToSavepoint(TEXT("catch_log"));
+			UE_LOG(LogDatabase, Error, TEXT("❌ Deferred %d caught fish: %s"), Records.Num(), *Database->GetLastError());
+			return INDEX_NONE;
+		}
 
+		if (UpsertCaughtFish(Record))
+		{
+			ReleaseSavepoint(TEXT("catch_record"));
+			++RecordedCount;
+		}
+		else
+		{
+			UE_LOG(LogDatabase, Error, TEXT("❌ Skipped caught fish PlayerID=%d Fish=%s: %s"),
+				Record.PlayerID, *Record.FishName, *Database->GetLastError());
+			RollbackToSavepoint(TEXT("catch_record"));
+		}
+	}
 
+	ReleaseSavepoint(TEXT("catch_log"));
+	OperationScope.SetRows(RecordedCount);
+	UE_LOG(LogDatabase, Log, TEXT("✅ Recorded %d/%d caught fish"), RecordedCount, Records.Num());
+	return RecordedCount;
+}
 
-bool UDatabaseManager::RecordCaughtFish(int32 PlayerID, const FString& FishDataPath, 
-	const FString& FishName, float Length, float Weight)
+bool UDatabaseManager::UpsertCaughtFish(const FCaughtFishRecord& Record)
 {
-	if (!Database || !Database->IsValid())
+	const int32 FishDefinitionID = FindOrCreateItemDefinition(Record.FishDataPath, TEXT("Fish"));
+	if (FishDefinitionID == INDEX_NONE)
 	{
 		return false;
 	}
 
-	FString CurrentTime = GetCurrentTimestamp();
-
-	bool bSuccess = ExecutePreparedQuery(
-		TEXT("INSERT INTO FishRecords (PlayerID, FishDataPath, FishName, CaughtCount, "
+	const bool bRecorded = ExecutePreparedQuery(
+		TEXT("INSERT INTO FishRecords (PlayerID, FishDefinitionID, FishName, CaughtCount, "
 		     "LargestLength, LargestWeight, FirstCaughtAt, LastCaughtAt) "
 		     "VALUES (?, ?, ?, 1, ?, ?, ?, ?) "
-		     "ON CONFLICT(PlayerID, FishDataPath) DO UPDATE SET "
+		     "ON CONFLICT(PlayerID, FishDefinitionID) DO UPDATE SET "
 		     "CaughtCount = CaughtCount + 1, "
 		     "LargestLength = MAX(LargestLength, ?), "
 		     "LargestWeight = MAX(LargestWeight, ?), "
 		     "LastCaughtAt = ?"),
-		[PlayerID, &FishDataPath, &FishName, Length, Weight, &CurrentTime](FSQLitePreparedStatement& Stmt) {
-			Stmt.SetBindingValueByIndex(1, PlayerID);
-			Stmt.SetBindingValueByIndex(2, FishDataPath);
-			Stmt.SetBindingValueByIndex(3, FishName);
-			Stmt.SetBindingValueByIndex(4, Length);
-			Stmt.SetBindingValueByIndex(5, Weight);
-			Stmt.SetBindingValueByIndex(6, CurrentTime);
-			Stmt.SetBindingValueByIndex(7, CurrentTime);
-			Stmt.SetBindingValueByIndex(8, Length);
-			Stmt.SetBindingValueByIndex(9, Weight);
-			Stmt.SetBindingValueByIndex(10, CurrentTime);
+		[&Record, FishDefinitionID](FSQLitePreparedStatement& Stmt) {
+			Stmt.SetBindingValueByIndex(1, Record.PlayerID);
+			Stmt.SetBindingValueByIndex(2, FishDefinitionID);
+			Stmt.SetBindingValueByIndex(3, Record.FishName);
+			Stmt.SetBindingValueByIndex(4, Record.Length);
+			Stmt.SetBindingValueByIndex(5, Record.Weight);
+			Stmt.SetBindingValueByIndex(6, Record.CaughtAt);
+			Stmt.SetBindingValueByIndex(7, Record.CaughtAt);
+			Stmt.SetBindingValueByIndex(8, Record.Length);
+			Stmt.SetBindingValueByIndex(9, Record.Weight);
+			Stmt.SetBindingValueByIndex(10, Record.CaughtAt);
 		});
 
-	if (bSuccess)
-	{
-		UE_LOG(LogDatabase, Log, TEXT("✅ Recorded fish: %s (%.1fcm, %.1fg)"), 
-			*FishName, Length, Weight);
-	}
-
-	return bSuccess;
+	return bRecorded && ExecutePreparedQuery(SessionLeaderboardUpsertQuery,
+		[&Record, FishDefinitionID](FSQLitePreparedStatement& Stmt) {
+			Stmt.SetBindingValueByIndex(1, Record.PlayerID);
+			Stmt.SetBindingValueByIndex(2, FishDefinitionID);
+		});
 }
 
 TMap<FString, int32> UDatabaseManager::LoadFishCatalog(int32 PlayerID)
 {
+	if (!IsInReadThread())
+	{
+		return RunOnReadThread<TMap<FString, int32>>([this, PlayerID]() { return LoadFishCatalog(PlayerID); });
+	}
+
 	TMap<FString, int32> Catalog;
 
-	if (!Database || !Database->IsValid())
+	if (!IsConnectionOpen())
 	{
 		return Catalog;
 	}
 
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database, 
-		TEXT("SELECT FishDataPath, CaughtCount FROM FishRecords WHERE PlayerID = ?"),
-		ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(
+		TEXT("SELECT D.AssetPath, F.CaughtCount FROM FishRecords F "
+		     "JOIN ItemDefinitions D ON D.DefinitionID = F.FishDefinitionID WHERE F.PlayerID = ?"));
+	if (!Statement)
 	{
 		return Catalog;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
-	Statement.SetBindingValueByIndex(1, PlayerID);
+	Statement->SetBindingValueByIndex(1, PlayerID);
 
-	while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
-		FString FishPath;
+		FString AssetPath;
 		int32 Count;
-		Statement.GetColumnValueByIndex(0, FishPath);
-		Statement.GetColumnValueByIndex(1, Count);
-		Catalog.Add(FishPath, Count);
+		Statement->GetColumnValueByIndex(0, AssetPath);
+		Statement->GetColumnValueByIndex(1, Count);
+		Catalog.Add(AssetPath, Count);
 	}
 
 	UE_LOG(LogDatabase, Log, TEXT("✅ Loaded fish catalog: %d species"), Catalog.Num());
@@ -668,28 +2070,36 @@ TMap<FString, int32> UDatabaseManager::LoadFishCatalog(int32 PlayerID)
 bool UDatabaseManager::GetLargestFish(int32 PlayerID, const FString& FishDataPath, 
 	float& OutLength, float& OutWeight)
 {
-	if (!Database || !Database->IsValid())
+	if (!IsInReadThread())
+	{
+		return RunOnReadThread<bool>([this, PlayerID, &FishDataPath, &OutLength, &OutWeight]() {
+			return GetLargestFish(PlayerID, FishDataPath, OutLength, OutWeight);
+		});
+	}
+
+	if (!IsConnectionOpen())
 	{
 		return false;
 	}
 
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database,
-		TEXT("SELECT LargestLength, LargestWeight FROM FishRecords "
-		     "WHERE PlayerID = ? AND FishDataPath = ?"),
-		ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(
+		TEXT("SELECT F.LargestLength, F.LargestWeight FROM FishRecords F "
+		     "JOIN ItemDefinitions D ON D.DefinitionID = F.FishDefinitionID "
+		     "WHERE F.PlayerID = ? AND D.AssetPath = ?"));
+	if (!Statement)
 	{
 		return false;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
-	Statement.SetBindingValueByIndex(1, PlayerID);
-	Statement.SetBindingValueByIndex(2, FishDataPath);
+	Statement->SetBindingValueByIndex(1, PlayerID);
+	Statement->SetBindingValueByIndex(2, FishDataPath);
 
-	if (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	if (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
 		double TempLength, TempWeight;
-		Statement.GetColumnValueByIndex(0, TempLength);
-		Statement.GetColumnValueByIndex(1, TempWeight);
+		Statement->GetColumnValueByIndex(0, TempLength);
+		Statement->GetColumnValueByIndex(1, TempWeight);
         
 		OutLength = static_cast<float>(TempLength);
 		OutWeight = static_cast<float>(TempWeight);
@@ -705,54 +2115,51 @@ bool UDatabaseManager::GetLargestFish(int32 PlayerID, const FString& FishDataPat
 
 TArray<FLeaderboardEntry> UDatabaseManager::GetSessionLeaderboard(int32 HostPlayerID)
 {
-    TArray<FLeaderboardEntry> Entries;
-
-    if (!Database || !Database->IsValid() || HostPlayerID == -1)
+    if (!IsInReadThread())
     {
-        UE_LOG(LogDatabase, Warning, TEXT("GetSessionLeaderboard: Invalid parameters"));
-        return Entries;
+        return RunOnReadThread<TArray<FLeaderboardEntry>>([this, HostPlayerID]() {
+            return GetSessionLeaderboard(HostPlayerID);
+        });
     }
 
-    TArray<int32> SessionPlayers = GetSessionPlayers(HostPlayerID);
-    SessionPlayers.Add(HostPlayerID);
+    DATABASE_OPERATION_SCOPE(GetSessionLeaderboard);
+
+    TArray<FLeaderboardEntry> Entries;
 
-    if (SessionPlayers.Num() == 0)
+    if (!IsConnectionOpen() || HostPlayerID == -1)
     {
+        UE_LOG(LogDatabase, Warning, TEXT("GetSessionLeaderboard: Invalid parameters"));
         return Entries;
     }
 
-    FString PlayerIDList = BuildPlayerIDList(SessionPlayers);
-    FString Query = FString::Printf(
-        TEXT("SELECT F.PlayerID, P.PlayerName, F.FishName, F.LargestLength, F.LargestWeight, "
-             "F.CaughtCount, F.LastCaughtAt "
-             "FROM FishRecords F "
-             "JOIN Players P ON F.PlayerID = P.PlayerID "
-             "WHERE F.PlayerID IN (%s) "
-             "ORDER BY F.LargestLength DESC"),
-        *PlayerIDList
-    );
-
-    FSQLitePreparedStatement Statement;
-    if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+    FSQLitePreparedStatement* Statement = GetCachedStatement(TEXT(
+        "SELECT PlayerID, PlayerName, FishName, LargestLength, LargestWeight, CaughtCount, LastCaughtAt "
+        "FROM SessionLeaderboard "
+        "WHERE SessionHostID = ? "
+        "ORDER BY LargestLength DESC"));
+    if (!Statement)
     {
         return Entries;
     }
+    ON_SCOPE_EXIT { Statement->Reset(); };
+
+    Statement->SetBindingValueByIndex(1, HostPlayerID);
 
     int32 Rank = 1;
-    while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+    while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
     {
         FLeaderboardEntry Entry;
         Entry.Rank = Rank++;
         
         double TempLength, TempWeight;
 
-        Statement.GetColumnValueByIndex(0, Entry.PlayerID);
-        Statement.GetColumnValueByIndex(1, Entry.PlayerName);
-        Statement.GetColumnValueByIndex(2, Entry.FishName);
-        Statement.GetColumnValueByIndex(3, TempLength);
-        Statement.GetColumnValueByIndex(4, TempWeight);
-        Statement.GetColumnValueByIndex(5, Entry.CaughtCount);
-        Statement.GetColumnValueByIndex(6, Entry.CaughtDate);
+        Statement->GetColumnValueByIndex(0, Entry.PlayerID);
+        Statement->GetColumnValueByIndex(1, Entry.PlayerName);
+        Statement->GetColumnValueByIndex(2, Entry.FishName);
+        Statement->GetColumnValueByIndex(3, TempLength);
+        Statement->GetColumnValueByIndex(4, TempWeight);
+        Statement->GetColumnValueByIndex(5, Entry.CaughtCount);
+        Statement->GetColumnValueByIndex(6, Entry.CaughtDate);
 
         Entry.Length = static_cast<float>(TempLength);
         Entry.Weight = static_cast<float>(TempWeight);
@@ -760,43 +2167,173 @@ TArray<FLeaderboardEntry> UDatabaseManager::GetSessionLeaderboard(int32 HostPlay
         Entries.Add(Entry);
     }
 
+    OperationScope.SetRows(Entries.Num());
     UE_LOG(LogDatabase, Log, TEXT("✅ GetSessionLeaderboard: Loaded %d entries"), Entries.Num());
     return Entries;
 }
 
-TArray<FString> UDatabaseManager::GetSessionFishTypes(int32 HostPlayerID)
+TArray<FLeaderboardEntry> UDatabaseManager::GetSessionLeaderboardPage(int32 HostPlayerID, ELeaderboardSortType SortType,
+    int32 Offset, int32 Limit)
 {
-	TArray<FString> FishTypes;
+    if (!IsInReadThread())
+    {
+        return RunOnReadThread<TArray<FLeaderboardEntry>>([this, HostPlayerID, SortType, Offset, Limit]() {
+            return GetSessionLeaderboardPage(HostPlayerID, SortType, Offset, Limit);
+        });
+    }
 
-	if (!Database || !Database->IsValid())
+    DATABASE_OPERATION_SCOPE(GetSessionLeaderboardPage);
+
+    TArray<FLeaderboardEntry> Entries;
+
+    if (!IsConnectionOpen() || HostPlayerID == -1 || Limit <= 0)
+    {
+        UE_LOG(LogDatabase, Warning, TEXT("GetSessionLeaderboardPage: Invalid parameters"));
+        return Entries;
+    }
+
+    Offset = FMath::Max(Offset, 0);
+
+    const FString Query = FString::Printf(TEXT(
+        "SELECT PlayerID, PlayerName, FishName, LargestLength, LargestWeight, CaughtCount, LastCaughtAt "
+        "FROM SessionLeaderboard "
+        "WHERE SessionHostID = ?1 "
+        "ORDER BY %s, EntryID "
+        "LIMIT ?2 OFFSET ?3"),
+        GetLeaderboardSortColumn(SortType));
+
+    FSQLitePreparedStatement* Statement = GetCachedStatement(Query);
+    if (!Statement)
+    {
+        return Entries;
+    }
+    ON_SCOPE_EXIT { Statement->Reset(); };
+
+    Statement->SetBindingValueByIndex(1, HostPlayerID);
+    Statement->SetBindingValueByIndex(2, Limit);
+    Statement->SetBindingValueByIndex(3, Offset);
+
+    Entries.Reserve(Limit);
+
+    int32 Rank = Offset + 1;
+    while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
+    {
+        FLeaderboardEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Rank = Rank++;
+
+        double TempLength, TempWeight;
+
+        Statement->GetColumnValueByIndex(0, Entry.PlayerID);
+        Statement->GetColumnValueByIndex(1, Entry.PlayerName);
+        Statement->GetColumnValueByIndex(2, Entry.FishName);
+        Statement->GetColumnValueByIndex(3, TempLength);
+        Statement->GetColumnValueByIndex(4, TempWeight);
+        Statement->GetColumnValueByIndex(5, Entry.CaughtCount);
+        Statement->GetColumnValueByIndex(6, Entry.CaughtDate);
+
+        Entry.Length = static_cast<float>(TempLength);
+        Entry.Weight = static_cast<float>(TempWeight);
+    }
+
+    OperationScope.SetRows(Entries.Num());
+    UE_LOG(LogDatabase, Log, TEXT("✅ GetSessionLeaderboardPage: Loaded %d entries (Offset=%d, Limit=%d)"),
+        Entries.Num(), Offset, Limit);
+    return Entries;
+}
+
+bool UDatabaseManager::GetSessionLeaderboardStats(int32 HostPlayerID, int32& OutRecordCount, int32& OutPlayerCount)
+{
+    if (!IsInReadThread())
+    {
+        return RunOnReadThread<bool>([this, HostPlayerID, &OutRecordCount, &OutPlayerCount]() {
+            return GetSessionLeaderboardStats(HostPlayerID, OutRecordCount, OutPlayerCount);
+        });
+    }
+
+    OutRecordCount = 0;
+    OutPlayerCount = 0;
+
+    if (!IsConnectionOpen() || HostPlayerID == -1)
+    {
+        return false;
+    }
+
+    FSQLitePreparedStatement* Statement = GetCachedStatement(TEXT(
+        "SELECT COUNT(*), COUNT(DISTINCT PlayerID) FROM SessionLeaderboard WHERE SessionHostID = ?"));
+    if (!Statement)
+    {
+        return false;
+    }
+    ON_SCOPE_EXIT { Statement->Reset(); };
+
+    Statement->SetBindingValueByIndex(1, HostPlayerID);
+
+    if (Statement->Step() != ESQLitePreparedStatementStepResult::Row)
+    {
+        return false;
+    }
+
+    Statement->GetColumnValueByIndex(0, OutRecordCount);
+    Statement->GetColumnValueByIndex(1, OutPlayerCount);
+    return true;
+}
+
+void UDatabaseManager::GetSessionLeaderboardPageAsync(int32 HostPlayerID, ELeaderboardSortType SortType, int32 Offset,
+	int32 Limit, TFunction<void(const TArray<FLeaderboardEntry>&, int32 TotalRecords, int32 TotalPlayers)> OnComplete,
+	EDatabaseReadConsistency Consistency)
+{
+	using FLeaderboardPageResult = TTuple<TArray<FLeaderboardEntry>, int32, int32>;
+
+	RunOnReadThreadAsync<FLeaderboardPageResult>(
+		[this, HostPlayerID, SortType, Offset, Limit]() {
+			FLeaderboardPageResult Result;
+			Result.Get<0>() = GetSessionLeaderboardPage(HostPlayerID, SortType, Offset, Limit);
+			GetSessionLeaderboardStats(HostPlayerID, Result.Get<1>(), Result.Get<2>());
+			return Result;
+		},
+		[OnComplete = MoveTemp(OnComplete)](FLeaderboardPageResult&& Result) {
+			if (OnComplete)
+			{
+				OnComplete(Result.Get<0>(), Result.Get<1>(), Result.Get<2>());
+			}
+		},
+		Consistency);
+}
+
+void UDatabaseManager::WaitForPendingWrites()
+{
+	FlushCaughtFish();
+	RunOnDatabaseThread<bool>([]() { return true; });
+}
+
+TArray<FString> UDatabaseManager::GetSessionFishTypes(int32 HostPlayerID)
+{
+	if (!IsInReadThread())
 	{
-		return FishTypes;
+		return RunOnReadThread<TArray<FString>>([this, HostPlayerID]() { return GetSessionFishTypes(HostPlayerID); });
 	}
 
-	TArray<int32> SessionPlayers = GetSessionPlayers(HostPlayerID);
-	SessionPlayers.Add(HostPlayerID);
+	TArray<FString> FishTypes;
 
-	if (SessionPlayers.Num() == 0)
+	if (!IsConnectionOpen())
 	{
 		return FishTypes;
 	}
 
-	FString PlayerIDList = BuildPlayerIDList(SessionPlayers);
-	FString Query = FString::Printf(
-		TEXT("SELECT DISTINCT FishName FROM FishRecords WHERE PlayerID IN (%s) ORDER BY FishName"),
-		*PlayerIDList
-	);
-
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(TEXT(
+		"SELECT DISTINCT FishName FROM SessionLeaderboard WHERE SessionHostID = ? ORDER BY FishName"));
+	if (!Statement)
 	{
 		return FishTypes;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
-	while (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	Statement->SetBindingValueByIndex(1, HostPlayerID);
+
+	while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
 		FString FishName;
-		Statement.GetColumnValueByIndex(0, FishName);
+		Statement->GetColumnValueByIndex(0, FishName);
 		FishTypes.Add(FishName);
 	}
 
@@ -810,33 +2347,157 @@ TArray<FString> UDatabaseManager::GetSessionFishTypes(int32 HostPlayerID)
 
 bool UDatabaseManager::BackupDatabase(const FString& BackupName)
 {
-	if (!Database || !Database->IsValid())
+	return BackupDatabaseAsync(BackupName);
+}
+
+bool UDatabaseManager::BackupDatabaseAsync(const FString& BackupName)
+{
+	if (DatabaseFilePath.IsEmpty())
 	{
 		return false;
 	}
 
-	FString BackupPath = FPaths::Combine(
-		FPaths::ProjectSavedDir(),
-		TEXT("Backups"),
-		BackupName + TEXT(".db")
-	);
+	if (bBackupInProgress.exchange(true))
+	{
+		UE_LOG(LogDatabase, Warning, TEXT("BackupDatabaseAsync: Backup already in progress"));
+		return false;
+	}
 
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	FString BackupDir = FPaths::GetPath(BackupPath);
-    
-	if (!PlatformFile.DirectoryExists(*BackupDir))
+	const FString BackupPath = GetBackupPath(BackupName);
+	const bool bRotate = BackupName.StartsWith(AutoBackupPrefix);
+	const int32 KeepCount = FMath::Max(GetDefault<UDatabaseSettings>()->AutoBackupsToKeep, 1);
+
+	UE_LOG(LogDatabase, Log, TEXT("BackupDatabaseAsync: Starting backup to %s"), *BackupPath);
+
+	BackupFuture = Async(EAsyncExecution::Thread,
+		[WeakThis = TWeakObjectPtr<UDatabaseManager>(this), SourcePath = DatabaseFilePath, BackupPath, bRotate, KeepCount]()
+		{
+			bool bSuccess = false;
+			FSQLiteDatabase Source;
+			if (Source.Open(*SourcePath, ESQLiteDatabaseOpenMode::ReadOnly))
+			{
+				Source.Execute(TEXT("PRAGMA busy_timeout = 5000;"));
+				bSuccess = WriteDatabaseSnapshot(Source, BackupPath);
+				Source.Close();
+			}
+			else
+			{
+				UE_LOG(LogDatabase, Error, TEXT("❌ Backup failed to open %s: %s"), *SourcePath, *Source.GetLastError());
+			}
+
+			if (bSuccess && bRotate)
+			{
+				RotateAutoBackups(KeepCount);
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess, BackupPath]()
+			{
+				if (UDatabaseManager* Manager = WeakThis.Get())
+				{
+					Manager->bBackupInProgress = false;
+					UE_LOG(LogDatabase, Log, TEXT("%s Backup finished: %s"), bSuccess ? TEXT("✅") : TEXT("❌"), *BackupPath);
+					Manager->OnBackupFinished.Broadcast(bSuccess, BackupPath);
+				}
+			});
+		});
+
+	return true;
+}
+
+bool UDatabaseManager::TickAutoBackup(float DeltaTime)
+{
+	BackupDatabaseAsync(FString(AutoBackupPrefix) + FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	return true;
+}
+
+void UDatabaseManager::RecordOperation(FName Operation, double ElapsedMs, int32 Rows)
+{
+	FScopeLock Lock(&OperationStatsLock);
+
+	FDatabaseOperationStats& Stats = OperationStats.FindOrAdd(Operation);
+	Stats.CallCount++;
+	Stats.RowsTouched += Rows;
+	Stats.MaxMs = FMath::Max(Stats.MaxMs, ElapsedMs);
+
+	if (Stats.RecentMs.Num() < OperationSampleCount)
+	{
+		Stats.RecentMs.Add(ElapsedMs);
+	}
+	else
 	{
-		PlatformFile.CreateDirectory(*BackupDir);
+		Stats.RecentMs[Stats.NextSampleIndex] = ElapsedMs;
 	}
+	Stats.NextSampleIndex = (Stats.NextSampleIndex + 1) % OperationSampleCount;
+}
 
-	if (PlatformFile.CopyFile(*BackupPath, *DatabaseFilePath))
+void UDatabaseManager::UpdateStorageStats()
+{
+	if (DatabaseFilePath.IsEmpty())
 	{
-		UE_LOG(LogDatabase, Log, TEXT("✅ Database backed up: %s"), *BackupPath);
-		return true;
+		return;
 	}
 
-	UE_LOG(LogDatabase, Error, TEXT("❌ Failed to backup database"));
-	return false;
+	const int64 DatabaseBytes = GetFileSizeOrZero(DatabaseFilePath);
+	const int64 WalBytes = GetFileSizeOrZero(DatabaseFilePath + TEXT("-wal"));
+	const int64 Hits = StatementCacheHits;
+	const int64 Lookups = Hits + StatementCacheMisses;
+	const float HitRatio = Lookups > 0 ? 100.0f * Hits / Lookups : 0.0f;
+
+	SET_MEMORY_STAT(STAT_Database_FileSize, DatabaseBytes);
+	SET_MEMORY_STAT(STAT_Database_WalSize, WalBytes);
+	SET_FLOAT_STAT(STAT_Database_StatementCacheHitRatio, HitRatio);
+
+	CSV_CUSTOM_STAT(FishingDatabase, DatabaseFileMB, DatabaseBytes / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FishingDatabase, WalFileMB, WalBytes / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FishingDatabase, StatementCacheHitPct, HitRatio, ECsvCustomStatOp::Set);
+}
+
+void UDatabaseManager::LogTelemetry()
+{
+	UpdateStorageStats();
+
+	int32 PageSize = 0;
+	int32 PageCount = 0;
+	int32 FreePages = 0;
+	RunOnDatabaseThread<bool>([this, &PageSize, &PageCount, &FreePages]() {
+		return ExecuteScalarInt(TEXT("PRAGMA page_size"), nullptr, PageSize)
+			&& ExecuteScalarInt(TEXT("PRAGMA page_count"), nullptr, PageCount)
+			&& ExecuteScalarInt(TEXT("PRAGMA freelist_count"), nullptr, FreePages);
+	});
+
+	const int64 Hits = StatementCacheHits;
+	const int64 Misses = StatementCacheMisses;
+
+	UE_LOG(LogDatabase, Log, TEXT("=== Database telemetry ==="));
+	UE_LOG(LogDatabase, Log, TEXT("File: %.2f MiB, WAL: %.2f MiB, Pages: %d x %d B (%d free)"),
+		GetFileSizeOrZero(DatabaseFilePath) / (1024.0 * 1024.0),
+		GetFileSizeOrZero(DatabaseFilePath + TEXT("-wal")) / (1024.0 * 1024.0),
+		PageCount, PageSize, FreePages);
+	UE_LOG(LogDatabase, Log, TEXT("Statement cache: %lld hits, %lld misses (%.1f%%)"),
+		Hits, Misses, Hits + Misses > 0 ? 100.0 * Hits / (Hits + Misses) : 0.0);
+
+	FScopeLock Lock(&OperationStatsLock);
+
+	TArray<FName> Operations;
+	OperationStats.GetKeys(Operations);
+	Operations.Sort(FNameLexicalLess());
+
+	for (const FName& Operation : Operations)
+	{
+		const FDatabaseOperationStats& Stats = OperationStats[Operation];
+		UE_LOG(LogDatabase, Log, TEXT("%-26s calls=%-6lld rows=%-8lld p50=%.2fms p95=%.2fms max=%.2fms"),
+			*Operation.ToString(), Stats.CallCount, Stats.RowsTouched,
+			GetSamplePercentile(Stats.RecentMs, 0.5f), GetSamplePercentile(Stats.RecentMs, 0.95f), Stats.MaxMs);
+	}
+}
+
+void UDatabaseManager::ResetTelemetry()
+{
+	FScopeLock Lock(&OperationStatsLock);
+	OperationStats.Reset();
+	StatementCacheHits = 0;
+	StatementCacheMisses = 0;
+	UE_LOG(LogDatabase, Log, TEXT("Database telemetry reset"));
 }
 
 bool UDatabaseManager::MigrateDatabase()
@@ -846,74 +2507,115 @@ bool UDatabaseManager::MigrateDatabase()
         return false;
     }
 
-    FSQLitePreparedStatement CheckStmt;
-    if (!CheckStmt.Create(*Database, TEXT("PRAGMA table_info(Players)"), 
-        ESQLitePreparedStatementFlags::Persistent))
+    struct FSchemaMigration
+    {
+        int32 Version;
+        const TCHAR* Name;
+        bool (UDatabaseManager::*Apply)();
+        bool bTransactional;
+    };
+
+    static const FSchemaMigration Migrations[] = {
+        { 1, TEXT("Create base tables"), &UDatabaseManager::CreateBaseTables, true },
+        { 2, TEXT("Session players"), &UDatabaseManager::MigrateSessionPlayers, true },
+        { 3, TEXT("Binary SpecificData"), &UDatabaseManager::MigrateSpecificDataToBinary, true },
+        { 4, TEXT("Item definitions"), &UDatabaseManager::MigrateToItemDefinitions, true },
+        { 5, TEXT("Query indexes"), &UDatabaseManager::CreateQueryIndexes, true },
+        { 6, TEXT("Session leaderboard backfill"), &UDatabaseManager::BackfillSessionLeaderboard, true },
+        { 7, TEXT("Cascading foreign keys"), &UDatabaseManager::MigrateToCascadingForeignKeys, true },
+        { 8, TEXT("Incremental auto-vacuum"), &UDatabaseManager::EnableIncrementalAutoVacuum, false }
+    };
+
+    const int32 HeadVersion = UE_ARRAY_COUNT(Migrations);
+    const int32 CurrentVersion = GetSchemaVersion();
+
+    if (CurrentVersion == HeadVersion)
+    {
+        return true;
+    }
+
+    if (CurrentVersion > HeadVersion || CurrentVersion < 0)
     {
+        UE_LOG(LogDatabase, Error, TEXT("❌ Unsupported schema version %d (this build supports up to %d)"), CurrentVersion, HeadVersion);
         return false;
     }
 
-    bool bHasHostPlayerID = false;
-    bool bHasIsHost = false;
-    
-    while (CheckStmt.Step() == ESQLitePreparedStatementStepResult::Row)
-    {
-        FString ColumnName;
-        CheckStmt.GetColumnValueByIndex(1, ColumnName);
-        
-        if (ColumnName == TEXT("HostPlayerID"))
+    ClearStatementCache();
+
+    for (const FSchemaMigration& Migration : Migrations)
+    {
+        if (Migration.Version <= CurrentVersion)
+        {
+            continue;
+        }
+
+        if (!Migration.bTransactional)
+        {
+            if (!(this->*Migration.Apply)() ||
+                !Database->Execute(*FString::Printf(TEXT("PRAGMA user_version = %d;"), Migration.Version)))
+            {
+                UE_LOG(LogDatabase, Error, TEXT("❌ Migration %d (%s) failed: %s"), Migration.Version, Migration.Name, *Database->GetLastError());
+                return false;
+            }
+
+            UE_LOG(LogDatabase, Log, TEXT("✅ Applied migration %d: %s"), Migration.Version, Migration.Name);
+            continue;
+        }
+
+        if (!BeginTransaction())
         {
-            bHasHostPlayerID = true;
+            return false;
         }
-        else if (ColumnName == TEXT("IsHost"))
+
+        if (!(this->*Migration.Apply)() ||
+            !Database->Execute(*FString::Printf(TEXT("PRAGMA user_version = %d;"), Migration.Version)) ||
+            !CommitTransaction())
         {
-            bHasIsHost = true;
+            UE_LOG(LogDatabase, Error, TEXT("❌ Migration %d (%s) failed: %s"), Migration.Version, Migration.Name, *Database->GetLastError());
+            RollbackTransaction();
+            return false;
         }
+
+        UE_LOG(LogDatabase, Log, TEXT("✅ Applied migration %d: %s"), Migration.Version, Migration.Name);
     }
 
-    bool bSuccess = true;
+    UE_LOG(LogDatabase, Log, TEXT("✅ Database migrated from version %d to %d"), CurrentVersion, HeadVersion);
+    return true;
+}
 
-    if (!bHasHostPlayerID)
+int32 UDatabaseManager::GetSchemaVersion()
+{
+    FSQLitePreparedStatement Statement;
+    if (!Statement.Create(*Database, TEXT("PRAGMA user_version")))
     {
-        bSuccess &= ExecuteQuery(TEXT("ALTER TABLE Players ADD COLUMN HostPlayerID INTEGER DEFAULT NULL"));
-        UE_LOG(LogDatabase, Log, TEXT("✅ Added HostPlayerID column"));
+        return INDEX_NONE;
     }
 
-    if (!bHasIsHost)
+    int32 Version = INDEX_NONE;
+    if (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
     {
-        bSuccess &= ExecuteQuery(TEXT("ALTER TABLE Players ADD COLUMN IsHost INTEGER DEFAULT 0"));
-        UE_LOG(LogDatabase, Log, TEXT("✅ Added IsHost column"));
-        
-        ExecuteQuery(TEXT("UPDATE Players SET IsHost = 1 WHERE IsHost IS NULL OR IsHost = 0"));
+        Statement.GetColumnValueByIndex(0, Version);
     }
-
-    ExecuteQuery(TEXT("CREATE INDEX IF NOT EXISTS idx_session_players ON Players(HostPlayerID)"));
-
-    UE_LOG(LogDatabase, Log, TEXT("✅ Database migration complete"));
-    return bSuccess;
+    Statement.Destroy();
+    return Version;
 }
 
-
-
-
-
 bool UDatabaseManager::ExecuteQuery(const FString& Query)
 {
-	if (!Database || !Database->IsValid())
+	FSQLiteDatabase* Connection = GetConnection();
+	if (!Connection || !Connection->IsValid())
 	{
 		UE_LOG(LogDatabase, Error, TEXT("Database not open"));
 		return false;
 	}
 
-	FSQLitePreparedStatement Statement;
-	if(!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	if (!Connection->Execute(*Query))
 	{
-		UE_LOG(LogDatabase, Error, TEXT("Failed to prepare: %s"), *Query);
-		UE_LOG(LogDatabase, Error, TEXT("Error: %s"), *Database->GetLastError());
+		UE_LOG(LogDatabase, Error, TEXT("Failed to execute: %s"), *Query);
+		UE_LOG(LogDatabase, Error, TEXT("Error: %s"), *Connection->GetLastError());
 		return false;
 	}
-	
-	return Statement.Execute();
+	return true;
 }
 
 bool UDatabaseManager::ExecutePreparedQuery(const FString& Query, TFunction<void(FSQLitePreparedStatement&)> BindFunc)
@@ -923,18 +2625,19 @@ bool UDatabaseManager::ExecutePreparedQuery(const FString& Query, TFunction<void
 		return false;
 	}
 
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(Query);
+	if (!Statement)
 	{
 		return false;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
 	if (BindFunc)
 	{
-		BindFunc(Statement);
+		BindFunc(*Statement);
 	}
 
-	return Statement.Execute();
+	return Statement->Execute();
 }
 
 bool UDatabaseManager::ExecuteScalarInt(const FString& Query, TFunction<void(FSQLitePreparedStatement&)> BindFunc, int32& OutValue)
@@ -944,20 +2647,21 @@ bool UDatabaseManager::ExecuteScalarInt(const FString& Query, TFunction<void(FSQ
 		return false;
 	}
 
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(Query);
+	if (!Statement)
 	{
 		return false;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
 	if (BindFunc)
 	{
-		BindFunc(Statement);
+		BindFunc(*Statement);
 	}
 
-	if (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	if (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
-		Statement.GetColumnValueByIndex(0, OutValue);
+		Statement->GetColumnValueByIndex(0, OutValue);
 		return true;
 	}
 
@@ -971,49 +2675,77 @@ bool UDatabaseManager::ExecuteScalarString(const FString& Query, TFunction<void(
 		return false;
 	}
 
-	FSQLitePreparedStatement Statement;
-	if (!Statement.Create(*Database, *Query, ESQLitePreparedStatementFlags::Persistent))
+	FSQLitePreparedStatement* Statement = GetCachedStatement(Query);
+	if (!Statement)
 	{
 		return false;
 	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
 
 	if (BindFunc)
 	{
-		BindFunc(Statement);
+		BindFunc(*Statement);
 	}
 
-	if (Statement.Step() == ESQLitePreparedStatementStepResult::Row)
+	if (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
 	{
-		Statement.GetColumnValueByIndex(0, OutValue);
+		Statement->GetColumnValueByIndex(0, OutValue);
 		return true;
 	}
 
 	return false;
 }
 
+FSQLitePreparedStatement* UDatabaseManager::GetCachedStatement(const FString& Query)
+{
+	FSQLiteDatabase* Connection = GetConnection();
+	if (!Connection || !Connection->IsValid())
+	{
+		return nullptr;
+	}
+
+	TMap<FString, TUniquePtr<FSQLitePreparedStatement>>& Cache =
+		Connection == ReadDatabase ? ReadStatementCache : StatementCache;
 
+	if (TUniquePtr<FSQLitePreparedStatement>* Cached = Cache.Find(Query))
+	{
+		StatementCacheHits++;
+		(*Cached)->Reset();
+		(*Cached)->ClearBindings();
+		return Cached->Get();
+	}
 
+	StatementCacheMisses++;
+	TUniquePtr<FSQLitePreparedStatement> Statement = MakeUnique<FSQLitePreparedStatement>();
+	if (!Statement->Create(*Connection, *Query, ESQLitePreparedStatementFlags::Persistent))
+	{
+		UE_LOG(LogDatabase, Error, TEXT("Failed to prepare: %s"), *Query);
+		UE_LOG(LogDatabase, Error, TEXT("Error: %s"), *Connection->GetLastError());
+		return nullptr;
+	}
 
+	return Cache.Add(Query, MoveTemp(Statement)).Get();
+}
 
-FString UDatabaseManager::BuildPlayerIDList(const TArray<int32>& PlayerIDs) const
+void UDatabaseManager::ClearStatementCache()
 {
-	FString Result;
-	for (int32 i = 0; i < PlayerIDs.Num(); i++)
+	for (TPair<FString, TUniquePtr<FSQLitePreparedStatement>>& Pair : StatementCache)
 	{
-		Result += FString::Printf(TEXT("%d"), PlayerIDs[i]);
-		if (i < PlayerIDs.Num() - 1)
-		{
-			Result += TEXT(",");
-		}
+		Pair.Value->Destroy();
 	}
-	return Result;
+	StatementCache.Empty();
 }
 
+
+
+
+
 bool UDatabaseManager::DeletePlayerData(int32 PlayerID)
 {
-	return ExecuteQuery(FString::Printf(TEXT("DELETE FROM InventoryItems WHERE PlayerID = %d"), PlayerID))
-		&& ExecuteQuery(FString::Printf(TEXT("DELETE FROM FishRecords WHERE PlayerID = %d"), PlayerID))
-		&& ExecuteQuery(FString::Printf(TEXT("DELETE FROM Players WHERE PlayerID = %d"), PlayerID));
+	return ExecutePreparedQuery(TEXT("DELETE FROM Players WHERE PlayerID = ?1 OR HostPlayerID = ?1"),
+		[PlayerID](FSQLitePreparedStatement& Stmt) {
+			Stmt.SetBindingValueByIndex(1, PlayerID);
+		});
 }
 
 
@@ -1027,89 +2759,522 @@ FString UDatabaseManager::GetCurrentTimestamp()
 
 bool UDatabaseManager::BeginTransaction()
 {
-	return ExecuteQuery(TEXT("BEGIN TRANSACTION"));
+	if (!ExecuteQuery(TEXT("BEGIN TRANSACTION")))
+	{
+		return false;
+	}
+
+	bInTransaction = true;
+	ItemDefinitionJournal.Reset();
+	SavepointJournalMarks.Reset();
+	return true;
 }
 
 bool UDatabaseManager::CommitTransaction()
 {
-	return ExecuteQuery(TEXT("COMMIT"));
+	if (!ExecuteQuery(TEXT("COMMIT")))
+	{
+		return false;
+	}
+
+	bInTransaction = false;
+	ItemDefinitionJournal.Reset();
+	SavepointJournalMarks.Reset();
+	return true;
 }
 
 bool UDatabaseManager::RollbackTransaction()
 {
-	return ExecuteQuery(TEXT("ROLLBACK"));
+	const bool bRolledBack = ExecuteQuery(TEXT("ROLLBACK"));
+	ForgetItemDefinitionsSince(0);
+	bInTransaction = false;
+	SavepointJournalMarks.Reset();
+	return bRolledBack;
+}
+
+bool UDatabaseManager::BeginSavepoint(const TCHAR* Name)
+{
+	if (!ExecuteQuery(FString::Printf(TEXT("SAVEPOINT %s"), Name)))
+	{
+		return false;
+	}
+
+	SavepointJournalMarks.Push(ItemDefinitionJournal.Num());
+	return true;
+}
+
+bool UDatabaseManager::ReleaseSavepoint(const TCHAR* Name)
+{
+	const bool bReleased = ExecuteQuery(FString::Printf(TEXT("RELEASE %s"), Name));
+	if (SavepointJournalMarks.Num() > 0)
+	{
+		SavepointJournalMarks.Pop();
+	}
+	if (SavepointJournalMarks.Num() == 0 && !bInTransaction)
+	{
+		ItemDefinitionJournal.Reset();
+	}
+	return bReleased;
+}
+
+bool UDatabaseManager::RollbackToSavepoint(const TCHAR* Name)
+{
+	const bool bRolledBack = ExecuteQuery(FString::Printf(TEXT("ROLLBACK TO %s"), Name));
+	ForgetItemDefinitionsSince(SavepointJournalMarks.Num() > 0 ? SavepointJournalMarks.Last() : 0);
+	ReleaseSavepoint(Name);
+	return bRolledBack;
+}
+
+void UDatabaseManager::ForgetItemDefinitionsSince(int32 JournalIndex)
+{
+	for (int32 i = JournalIndex; i < ItemDefinitionJournal.Num(); ++i)
+	{
+		const FItemDefinition* Definition = ItemDefinitions.Find(ItemDefinitionJournal[i]);
+		if (Definition)
+		{
+			ItemDefinitionIDs.Remove(Definition->AssetPath);
+			ItemDefinitions.Remove(ItemDefinitionJournal[i]);
+		}
+	}
+
+	if (JournalIndex < ItemDefinitionJournal.Num())
+	{
+		UE_LOG(LogDatabase, Verbose, TEXT("Forgot %d rolled-back item definitions"),
+			ItemDefinitionJournal.Num() - JournalIndex);
+		ItemDefinitionJournal.SetNum(JournalIndex);
+	}
+}
+
+bool UDatabaseManager::LoadItemDefinitions()
+{
+	ItemDefinitionIDs.Reset();
+	ItemDefinitions.Reset();
+
+	FSQLitePreparedStatement* Statement = GetCachedStatement(
+		TEXT("SELECT DefinitionID, AssetPath, Category FROM ItemDefinitions"));
+	if (!Statement)
+	{
+		return false;
+	}
+	ON_SCOPE_EXIT { Statement->Reset(); };
+
+	while (Statement->Step() == ESQLitePreparedStatementStepResult::Row)
+	{
+		int32 DefinitionID;
+		FItemDefinition Definition;
+		Statement->GetColumnValueByIndex(0, DefinitionID);
+		Statement->GetColumnValueByIndex(1, Definition.AssetPath);
+		Statement->GetColumnValueByIndex(2, Definition.Category);
+
+		ItemDefinitionIDs.Add(Definition.AssetPath, DefinitionID);
+		ItemDefinitions.Add(DefinitionID, MoveTemp(Definition));
+	}
+
+	UE_LOG(LogDatabase, Log, TEXT("Loaded %d item definitions"), ItemDefinitions.Num());
+	return true;
+}
+
+int32 UDatabaseManager::FindOrCreateItemDefinition(const FString& AssetPath, const FString& Category)
+{
+	if (const int32* ExistingID = ItemDefinitionIDs.Find(AssetPath))
+	{
+		return *ExistingID;
+	}
+
+	const bool bInserted = ExecutePreparedQuery(
+		TEXT("INSERT INTO ItemDefinitions (AssetPath, Category) VALUES (?, ?)"),
+		[&AssetPath, &Category](FSQLitePreparedStatement& Stmt) {
+			Stmt.SetBindingValueByIndex(1, AssetPath);
+			Stmt.SetBindingValueByIndex(2, Category);
+		});
+
+	if (!bInserted)
+	{
+		UE_LOG(LogDatabase, Error, TEXT("❌ Failed to add item definition: %s"), *AssetPath);
+		return INDEX_NONE;
+	}
+
+	const int32 DefinitionID = static_cast<int32>(Database->GetLastInsertRowId());
+	ItemDefinitionIDs.Add(AssetPath, DefinitionID);
+	ItemDefinitions.Add(DefinitionID, FItemDefinition{ AssetPath, Category });
+
+	if (bInTransaction || SavepointJournalMarks.Num() > 0)
+	{
+		ItemDefinitionJournal.Add(DefinitionID);
+	}
+	return DefinitionID;
+}
+
+
+
+
+
+bool UDatabaseManager::MigrateToItemDefinitions()
+{
+    const bool bLegacyInventory = GetTableColumns(*Database, TEXT("InventoryItems")).Contains(TEXT("ItemDataProviderPath"));
+    const bool bLegacyFishRecords = GetTableColumns(*Database, TEXT("FishRecords")).Contains(TEXT("FishDataPath"));
+    const bool bLegacyLeaderboard = GetTableColumns(*Database, TEXT("SessionLeaderboard")).Contains(TEXT("FishDataPath"));
+
+    if (!bLegacyInventory && !bLegacyFishRecords && !bLegacyLeaderboard)
+    {
+        return true;
+    }
+
+    TArray<FString> Queries;
+
+    if (bLegacyInventory)
+    {
+        Queries.Add(TEXT(
+            "INSERT OR IGNORE INTO ItemDefinitions (AssetPath, Category) "
+            "SELECT ItemDataProviderPath, MIN(ItemCategory) FROM InventoryItems GROUP BY ItemDataProviderPath"));
+        Queries.Add(BuildInventoryItemsTableQuery(TEXT("InventoryItems_New")));
+        Queries.Add(TEXT(
+            "INSERT INTO InventoryItems_New (ItemID, PlayerID, ItemGuid, DefinitionID, GridX, GridY, bIsRotated, SpecificData) "
+            "SELECT I.ItemID, I.PlayerID, I.ItemGuid, D.DefinitionID, I.GridX, I.GridY, I.bIsRotated, I.SpecificData "
+            "FROM InventoryItems I "
+            "JOIN ItemDefinitions D ON D.AssetPath = I.ItemDataProviderPath"));
+        Queries.Add(TEXT("DROP TABLE InventoryItems"));
+        Queries.Add(TEXT("ALTER TABLE InventoryItems_New RENAME TO InventoryItems"));
+    }
+
+    if (bLegacyFishRecords)
+    {
+        Queries.Add(TEXT(
+            "INSERT OR IGNORE INTO ItemDefinitions (AssetPath, Category) "
+            "SELECT DISTINCT FishDataPath, 'Fish' FROM FishRecords"));
+        Queries.Add(BuildFishRecordsTableQuery(TEXT("FishRecords_New")));
+        Queries.Add(TEXT(
+            "INSERT INTO FishRecords_New (RecordID, PlayerID, FishDefinitionID, FishName, CaughtCount, "
+            "LargestLength, LargestWeight, FirstCaughtAt, LastCaughtAt) "
+            "SELECT F.RecordID, F.PlayerID, D.DefinitionID, F.FishName, F.CaughtCount, "
+            "F.LargestLength, F.LargestWeight, F.FirstCaughtAt, F.LastCaughtAt "
+            "FROM FishRecords F "
+            "JOIN ItemDefinitions D ON D.AssetPath = F.FishDataPath"));
+        Queries.Add(TEXT("DROP TABLE FishRecords"));
+        Queries.Add(TEXT("ALTER TABLE FishRecords_New RENAME TO FishRecords"));
+    }
+
+    if (bLegacyLeaderboard)
+    {
+        Queries.Add(TEXT("DROP TABLE SessionLeaderboard"));
+        Queries.Add(BuildSessionLeaderboardTableQuery(TEXT("SessionLeaderboard")));
+    }
+
+    for (const FString& Query : Queries)
+    {
+        if (!Database->Execute(*Query))
+        {
+            UE_LOG(LogDatabase, Error, TEXT("❌ Item definition migration failed: %s"), *Database->GetLastError());
+            return false;
+        }
+    }
+
+    UE_LOG(LogDatabase, Log, TEXT("✅ Migrated asset paths to ItemDefinitions"));
+    return true;
+}
+
+bool UDatabaseManager::MigrateToCascadingForeignKeys()
+{
+    TArray<FString> Queries = {
+        TEXT("DELETE FROM Players WHERE HostPlayerID IS NOT NULL AND HostPlayerID NOT IN (SELECT PlayerID FROM Players)"),
+        TEXT("DELETE FROM InventoryItems WHERE PlayerID NOT IN (SELECT PlayerID FROM Players)"),
+        TEXT("DELETE FROM FishRecords WHERE PlayerID NOT IN (SELECT PlayerID FROM Players)"),
+        TEXT("DELETE FROM SessionLeaderboard WHERE PlayerID NOT IN (SELECT PlayerID FROM Players) "
+             "OR SessionHostID NOT IN (SELECT PlayerID FROM Players)"),
+
+        BuildPlayersTableQuery(TEXT("Players_New")),
+        TEXT("INSERT INTO Players_New (PlayerID, PlayerName, VillageName, TotalMoney, LastSaveTime, CreatedAt, HostPlayerID, IsHost) "
+             "SELECT PlayerID, PlayerName, VillageName, TotalMoney, LastSaveTime, CreatedAt, HostPlayerID, IsHost FROM Players"),
+        TEXT("DROP TABLE Players"),
+        TEXT("ALTER TABLE Players_New RENAME TO Players"),
+
+        BuildInventoryItemsTableQuery(TEXT("InventoryItems_New")),
+        TEXT("INSERT INTO InventoryItems_New (ItemID, PlayerID, ItemGuid, DefinitionID, GridX, GridY, bIsRotated, SpecificData) "
+             "SELECT ItemID, PlayerID, ItemGuid, DefinitionID, GridX, GridY, bIsRotated, SpecificData FROM InventoryItems"),
+        TEXT("DROP TABLE InventoryItems"),
+        TEXT("ALTER TABLE InventoryItems_New RENAME TO InventoryItems"),
+
+        BuildFishRecordsTableQuery(TEXT("FishRecords_New")),
+        TEXT("INSERT INTO FishRecords_New (RecordID, PlayerID, FishDefinitionID, FishName, CaughtCount, "
+             "LargestLength, LargestWeight, FirstCaughtAt, LastCaughtAt) "
+             "SELECT RecordID, PlayerID, FishDefinitionID, FishName, CaughtCount, "
+             "LargestLength, LargestWeight, FirstCaughtAt, LastCaughtAt FROM FishRecords"),
+        TEXT("DROP TABLE FishRecords"),
+        TEXT("ALTER TABLE FishRecords_New RENAME TO FishRecords"),
+
+        BuildSessionLeaderboardTableQuery(TEXT("SessionLeaderboard_New")),
+        TEXT("INSERT INTO SessionLeaderboard_New (EntryID, SessionHostID, PlayerID, FishDefinitionID, PlayerName, FishName, "
+             "LargestLength, LargestWeight, CaughtCount, LastCaughtAt) "
+             "SELECT EntryID, SessionHostID, PlayerID, FishDefinitionID, PlayerName, FishName, "
+             "LargestLength, LargestWeight, CaughtCount, LastCaughtAt FROM SessionLeaderboard"),
+        TEXT("DROP TABLE SessionLeaderboard"),
+        TEXT("ALTER TABLE SessionLeaderboard_New RENAME TO SessionLeaderboard")
+    };
+
+    for (const FString& Query : Queries)
+    {
+        if (!Database->Execute(*Query))
+        {
+            UE_LOG(LogDatabase, Error, TEXT("❌ Foreign key migration failed: %s"), *Database->GetLastError());
+            return false;
+        }
+    }
+
+    UE_LOG(LogDatabase, Log, TEXT("✅ Rebuilt tables with cascading foreign keys"));
+    return CreateQueryIndexes();
+}
+
+bool UDatabaseManager::EnableIncrementalAutoVacuum()
+{
+    int32 AutoVacuumMode = 0;
+    ExecuteScalarInt(TEXT("PRAGMA auto_vacuum"), nullptr, AutoVacuumMode);
+    if (AutoVacuumMode == 2)
+    {
+        return true;
+    }
+
+    ClearStatementCache();
+    return Database->Execute(TEXT("PRAGMA auto_vacuum = INCREMENTAL;"))
+        && Database->Execute(TEXT("VACUUM;"));
+}
+
+bool UDatabaseManager::BackfillSessionLeaderboard()
+{
+    FSQLitePreparedStatement CountStmt;
+    if (!CountStmt.Create(*Database, TEXT(
+        "SELECT (SELECT COUNT(*) FROM SessionLeaderboard), (SELECT COUNT(*) FROM FishRecords)")))
+    {
+        return false;
+    }
+
+    int32 LeaderboardRows = 0;
+    int32 FishRecordRows = 0;
+    if (CountStmt.Step() == ESQLitePreparedStatementStepResult::Row)
+    {
+        CountStmt.GetColumnValueByIndex(0, LeaderboardRows);
+        CountStmt.GetColumnValueByIndex(1, FishRecordRows);
+    }
+    CountStmt.Destroy();
+
+    if (LeaderboardRows > 0 || FishRecordRows == 0)
+    {
+        return true;
+    }
+
+    const bool bSuccess = ExecuteQuery(TEXT(
+        "INSERT OR IGNORE INTO SessionLeaderboard (SessionHostID, PlayerID, FishDefinitionID, PlayerName, FishName, "
+        "LargestLength, LargestWeight, CaughtCount, LastCaughtAt) "
+        "SELECT COALESCE(P.HostPlayerID, P.PlayerID), F.PlayerID, F.FishDefinitionID, P.PlayerName, F.FishName, "
+        "F.LargestLength, F.LargestWeight, F.CaughtCount, F.LastCaughtAt "
+        "FROM FishRecords F "
+        "JOIN Players P ON P.PlayerID = F.PlayerID"));
+
+    if (bSuccess)
+    {
+        UE_LOG(LogDatabase, Log, TEXT("✅ Backfilled SessionLeaderboard from %d fish records"), FishRecordRows);
+    }
+    return bSuccess;
 }
 
+bool UDatabaseManager::MigrateSpecificDataToBinary()
+{
+    const TSet<FString> InventoryColumns = GetTableColumns(*Database, TEXT("InventoryItems"));
+
+    if (!InventoryColumns.Contains(TEXT("SpecificData")))
+    {
+        if (!ExecuteQuery(TEXT("ALTER TABLE InventoryItems ADD COLUMN SpecificData BLOB")))
+        {
+            return false;
+        }
+        UE_LOG(LogDatabase, Log, TEXT("✅ Added SpecificData column"));
+    }
+
+    if (!InventoryColumns.Contains(TEXT("SpecificDataJSON")))
+    {
+        return true;
+    }
+
+    TArray<TPair<int64, FString>> LegacyRows;
+    {
+        FSQLitePreparedStatement SelectStmt;
+        if (!SelectStmt.Create(*Database, TEXT(
+            "SELECT ItemID, SpecificDataJSON FROM InventoryItems "
+            "WHERE SpecificDataJSON IS NOT NULL AND SpecificData IS NULL")))
+        {
+            return false;
+        }
+
+        while (SelectStmt.Step() == ESQLitePreparedStatementStepResult::Row)
+        {
+            TPair<int64, FString>& Row = LegacyRows.AddDefaulted_GetRef();
+            SelectStmt.GetColumnValueByIndex(0, Row.Key);
+            SelectStmt.GetColumnValueByIndex(1, Row.Value);
+        }
+    }
 
+    if (LegacyRows.Num() == 0)
+    {
+        return true;
+    }
 
+    for (const TPair<int64, FString>& Row : LegacyRows)
+    {
+        FItemSpecificData Data;
+        DeserializeLegacySpecificData(Row.Value, Data);
+        const TArray<uint8> Bytes = SerializeSpecificData(Data);
+
+        const bool bUpdated = ExecutePreparedQuery(
+            TEXT("UPDATE InventoryItems SET SpecificData = ?, SpecificDataJSON = NULL WHERE ItemID = ?"),
+            [&Bytes, &Row](FSQLitePreparedStatement& Stmt) {
+                Stmt.SetBindingValueByIndex(1, TArrayView<const uint8>(Bytes));
+                Stmt.SetBindingValueByIndex(2, Row.Key);
+            });
+
+        if (!bUpdated)
+        {
+            return false;
+        }
+    }
 
+    UE_LOG(LogDatabase, Log, TEXT("✅ Converted %d inventory rows from JSON to binary SpecificData"), LegacyRows.Num());
+    return true;
+}
 
-FString UDatabaseManager::SerializeSpecificData(const FItemSpecificData& Data)
+TArray<uint8> UDatabaseManager::SerializeSpecificData(const FItemSpecificData& Data)
 {
+    TArray<uint8> Bytes;
+
     if (!Data.HasSpecificData())
     {
-        return TEXT("{}");
+        return Bytes;
     }
 
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    FMemoryWriter Writer(Bytes);
+
+    uint8 Version = SpecificDataVersion;
+    uint8 Type = static_cast<uint8>(Data.ActiveType);
+    Writer << Version;
+    Writer << Type;
 
     switch (Data.ActiveType)
     {
     case EItemSpecificDataType::Fish:
         {
-            const FFishSpecificData* FishData = Data.GetFishData();
-            if (FishData && FishData->IsValid())
-            {
-                RootObject->SetStringField(TEXT("Type"), TEXT("Fish"));
-                RootObject->SetNumberField(TEXT("Length"), FishData->ActualLength);
-                RootObject->SetNumberField(TEXT("Weight"), FishData->ActualWeight);
-                RootObject->SetStringField(TEXT("Name"), FishData->FishDataName);
-                RootObject->SetStringField(TEXT("Location"), FishData->CaughtLocation);
-                RootObject->SetStringField(TEXT("Time"), FishData->CaughtTime.ToString());
-                RootObject->SetNumberField(TEXT("MinLength"), FishData->MinLength);
-                RootObject->SetNumberField(TEXT("MaxLength"), FishData->MaxLength);
-                RootObject->SetNumberField(TEXT("MinWeight"), FishData->MinWeight);
-                RootObject->SetNumberField(TEXT("MaxWeight"), FishData->MaxWeight);
-            }
+            FFishSpecificData FishData = Data.FishData;
+            Writer << FishData.ActualLength;
+            Writer << FishData.ActualWeight;
+            Writer << FishData.FishDataName;
+            Writer << FishData.CaughtLocation;
+            Writer << FishData.CaughtTime;
+            Writer << FishData.MinLength;
+            Writer << FishData.MaxLength;
+            Writer << FishData.MinWeight;
+            Writer << FishData.MaxWeight;
         }
         break;
 
     case EItemSpecificDataType::Equipment:
         {
-            const FEquipmentSpecificData* EquipData = Data.GetEquipmentData();
-            if (EquipData && EquipData->IsValid())
-            {
-                RootObject->SetStringField(TEXT("Type"), TEXT("Equipment"));
-                RootObject->SetNumberField(TEXT("Durability"), EquipData->Durability);
-                RootObject->SetNumberField(TEXT("MaxDurability"), EquipData->MaxDurability);
-                RootObject->SetNumberField(TEXT("EnhancementLevel"), EquipData->EnhancementLevel);
-                RootObject->SetBoolField(TEXT("IsEquipped"), EquipData->bIsEquipped);
-            }
+            FEquipmentSpecificData EquipData = Data.EquipmentData;
+            uint8 bIsEquipped = EquipData.bIsEquipped ? 1 : 0;
+            Writer << EquipData.Durability;
+            Writer << EquipData.MaxDurability;
+            Writer << EquipData.EnhancementLevel;
+            Writer << bIsEquipped;
         }
         break;
 
     case EItemSpecificDataType::Consumable:
         {
-            const FConsumableSpecificData* ConsData = Data.GetConsumableData();
-            if (ConsData && ConsData->IsValid())
-            {
-                RootObject->SetStringField(TEXT("Type"), TEXT("Consumable"));
-                RootObject->SetNumberField(TEXT("StackCount"), ConsData->StackCount);
-                RootObject->SetNumberField(TEXT("MaxStackCount"), ConsData->MaxStackCount);
-                RootObject->SetStringField(TEXT("ExpirationDate"), ConsData->ExpirationDate.ToString());
-            }
+            FConsumableSpecificData ConsData = Data.ConsumableData;
+            Writer << ConsData.StackCount;
+            Writer << ConsData.MaxStackCount;
+            Writer << ConsData.ExpirationDate;
         }
         break;
+
+    default:
+        break;
     }
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
-    
-    return OutputString;
+    return Bytes;
+}
+
+void UDatabaseManager::DeserializeSpecificData(const TArray<uint8>& Bytes, FItemSpecificData& OutData)
+{
+    OutData.Reset();
+
+    if (Bytes.Num() < 2)
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Bytes);
+
+    uint8 Version = 0;
+    uint8 Type = 0;
+    Reader << Version;
+    Reader << Type;
+
+    if (Version != SpecificDataVersion)
+    {
+        UE_LOG(LogDatabase, Error, TEXT("Unsupported SpecificData version: %d"), Version);
+        return;
+    }
+
+    switch (static_cast<EItemSpecificDataType>(Type))
+    {
+    case EItemSpecificDataType::Fish:
+        {
+            FFishSpecificData FishData;
+            Reader << FishData.ActualLength;
+            Reader << FishData.ActualWeight;
+            Reader << FishData.FishDataName;
+            Reader << FishData.CaughtLocation;
+            Reader << FishData.CaughtTime;
+            Reader << FishData.MinLength;
+            Reader << FishData.MaxLength;
+            Reader << FishData.MinWeight;
+            Reader << FishData.MaxWeight;
+            OutData.SetFishData(FishData);
+        }
+        break;
+
+    case EItemSpecificDataType::Equipment:
+        {
+            FEquipmentSpecificData EquipData;
+            uint8 bIsEquipped = 0;
+            Reader << EquipData.Durability;
+            Reader << EquipData.MaxDurability;
+            Reader << EquipData.EnhancementLevel;
+            Reader << bIsEquipped;
+            EquipData.bIsEquipped = bIsEquipped != 0;
+            OutData.SetEquipmentData(EquipData);
+        }
+        break;
+
+    case EItemSpecificDataType::Consumable:
+        {
+            FConsumableSpecificData ConsData;
+            Reader << ConsData.StackCount;
+            Reader << ConsData.MaxStackCount;
+            Reader << ConsData.ExpirationDate;
+            OutData.SetConsumableData(ConsData);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogDatabase, Error, TEXT("Failed to read SpecificData (%d bytes)"), Bytes.Num());
+        OutData.Reset();
+    }
 }
 
-void UDatabaseManager::DeserializeSpecificData(const FString& JSON, FItemSpecificData& OutData)
+void UDatabaseManager::DeserializeLegacySpecificData(const FString& JSON, FItemSpecificData& OutData)
 {
     OutData.Reset();
 
@@ -4,10 +4,15 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "SQLiteDatabase.h"
-#include "../Data/ItemSpecificData.h"
+#include "DatabaseWorker.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+#include "Variant_Fishing/Data/ItemSpecificData.h"
 #include "DatabaseManager.generated.h"
 
 struct FLeaderboardEntry;
+enum class ELeaderboardSortType : uint8;
 class UItemBase;
 
 USTRUCT(BlueprintType)
@@ -35,8 +40,87 @@ struct FSaveSlotInfo
 	
 	UPROPERTY(BlueprintReadOnly, Category = "SaveSlot")
 	bool bIsHost = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveSlot")
+	int32 GuestCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveSlot")
+	int32 TotalFishCaught = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveSlot")
+	FString BestCatchName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveSlot")
+	float BestCatchLength = 0.0f;
+};
+
+struct FInventoryItemRecord
+{
+	FString ItemGuid;
+	FString ItemDataProviderPath;
+	FString ItemCategory;
+	FIntPoint GridPosition = FIntPoint::ZeroValue;
+	bool bIsRotated = false;
+	TArray<uint8> SpecificData;
+};
+
+struct FItemDefinition
+{
+	FString AssetPath;
+	FString Category;
+};
+
+struct FInventoryItemSnapshot
+{
+	FGuid ItemGuid;
+	int32 DefinitionIndex = INDEX_NONE;
+	FIntPoint GridPosition = FIntPoint::ZeroValue;
+	bool bIsRotated = false;
+	FItemSpecificData SpecificData;
+};
+
+struct FInventorySnapshot
+{
+	TArray<FItemDefinition> Definitions;
+	TArray<FInventoryItemSnapshot> Items;
+};
+
+struct FCaughtFishRecord
+{
+	int32 PlayerID = -1;
+	FString FishDataPath;
+	FString FishName;
+	float Length = 0.0f;
+	float Weight = 0.0f;
+	FString CaughtAt;
+};
+
+struct FPlayerSaveSnapshot
+{
+	int32 PlayerID = -1;
+	int32 TotalMoney = 0;
+	bool bFullInventory = false;
+	FInventorySnapshot Inventory;
+	TArray<FGuid> RemovedItemGuids;
+};
+
+enum class EDatabaseReadConsistency : uint8
+{
+	Snapshot,
+	ReadYourWrites
 };
 
+struct FDatabaseOperationStats
+{
+	int64 CallCount = 0;
+	int64 RowsTouched = 0;
+	double MaxMs = 0.0;
+	TArray<float> RecentMs;
+	int32 NextSampleIndex = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDatabaseBackupFinished, bool, bSuccess, const FString&, BackupPath);
+
 UCLASS()
 class FISHING_API UDatabaseManager : public UGameInstanceSubsystem
 {
@@ -70,6 +154,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Database|SaveSlot")
 	TArray<FSaveSlotInfo> GetAllSaveSlots(); 
 
+	void GetAllSaveSlotsAsync(TFunction<void(const TArray<FSaveSlotInfo>&)> OnComplete,
+		EDatabaseReadConsistency Consistency = EDatabaseReadConsistency::Snapshot);
+
 	UFUNCTION(BlueprintCallable, Category = "Database|SaveSlot")
 	int32 FindOrCreateSaveSlot(const FString& PlayerName, const FString& VillageName); 
 
@@ -120,6 +207,22 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Database|Inventory")
 	bool ClearInventory(int32 PlayerID);
+
+	void SaveInventoryAsync(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ItemsWithPositions,
+		TFunction<void(bool)> OnComplete = nullptr);
+
+	bool SaveInventoryChanges(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ChangedItems,
+		const TArray<FGuid>& RemovedItemGuids);
+	void SaveInventoryChangesAsync(int32 PlayerID, const TMap<UItemBase*, FIntPoint>& ChangedItems,
+		const TArray<FGuid>& RemovedItemGuids, TFunction<void(bool)> OnComplete = nullptr);
+	void LoadInventoryAsync(int32 PlayerID, UObject* Outer,
+		TFunction<void(const TMap<UItemBase*, FIntPoint>&)> OnComplete);
+	void SavePlayerMoneyAsync(int32 PlayerID, int32 TotalMoney, TFunction<void(bool)> OnComplete = nullptr);
+
+	TArray<int32> SaveSession(const TArray<FPlayerSaveSnapshot>& Snapshots);
+	void SaveSessionAsync(TArray<FPlayerSaveSnapshot> Snapshots,
+		TFunction<void(const TArray<int32>& FailedPlayerIDs)> OnComplete = nullptr);
+	static FInventorySnapshot CaptureInventorySnapshot(const TMap<UItemBase*, FIntPoint>& ItemsWithPositions);
 	
 	
 	
@@ -139,8 +242,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Database|Leaderboard")
 	TArray<FLeaderboardEntry> GetSessionLeaderboard(int32 HostPlayerID);
 	
+	UFUNCTION(BlueprintCallable, Category = "Database|Leaderboard")
+	TArray<FLeaderboardEntry> GetSessionLeaderboardPage(int32 HostPlayerID, ELeaderboardSortType SortType,
+		int32 Offset, int32 Limit);
+
+	UFUNCTION(BlueprintCallable, Category = "Database|Leaderboard")
+	bool GetSessionLeaderboardStats(int32 HostPlayerID, int32& OutRecordCount, int32& OutPlayerCount);
+	
 	UFUNCTION(BlueprintCallable, Category = "Database|Leaderboard")
 	TArray<FString> GetSessionFishTypes(int32 HostPlayerID);
+
+	void QueueCaughtFish(int32 PlayerID, const FString& FishDataPath, const FString& FishName,
+		float Length, float Weight);
+
+	UFUNCTION(BlueprintCallable, Category = "Database|Fish")
+	void FlushCaughtFish();
+
+	bool ConsumeUnreadCatches();
+	void GetSessionLeaderboardPageAsync(int32 HostPlayerID, ELeaderboardSortType SortType, int32 Offset, int32 Limit,
+		TFunction<void(const TArray<FLeaderboardEntry>&, int32 TotalRecords, int32 TotalPlayers)> OnComplete,
+		EDatabaseReadConsistency Consistency = EDatabaseReadConsistency::Snapshot);
+
+	UFUNCTION(BlueprintCallable, Category = "Database")
+	void WaitForPendingWrites();
 	
 	
 	
@@ -152,10 +276,44 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Database")
 	bool BackupDatabase(const FString& BackupName);
 
+	UFUNCTION(BlueprintCallable, Category = "Database")
+	bool BackupDatabaseAsync(const FString& BackupName);
+
+	UFUNCTION(BlueprintPure, Category = "Database")
+	bool IsBackupInProgress() const { return bBackupInProgress; }
+
+	UPROPERTY(BlueprintAssignable, Category = "Database")
+	FOnDatabaseBackupFinished OnBackupFinished;
+
+	void BenchmarkInventoryInserts(const TArray<int32>& ItemCounts);
+
+	UFUNCTION(BlueprintCallable, Category = "Database|Telemetry")
+	void LogTelemetry();
+
+	UFUNCTION(BlueprintCallable, Category = "Database|Telemetry")
+	void ResetTelemetry();
+
+	void RecordOperation(FName Operation, double ElapsedMs, int32 Rows);
+
 protected:
 	bool MigrateDatabase();
+	int32 GetSchemaVersion();
+	bool CreateBaseTables();
+	bool MigrateSessionPlayers();
+	bool CreateQueryIndexes();
+	bool MigrateToCascadingForeignKeys();
+	bool EnableIncrementalAutoVacuum();
+	void ReclaimFreePages();
+	void ApplyDatabaseSettings();
+	bool OpenReadConnection();
+	void CloseReadConnection();
+	
+	TUniquePtr<FDatabaseWorker> DatabaseWorker;
+	TUniquePtr<FDatabaseWorker> ReadWorker;
 	
 	FSQLiteDatabase* Database = nullptr; 
+	FSQLiteDatabase* ReadDatabase = nullptr;
+	std::atomic<bool> bReadConnectionOpen{false};
 	FString DatabaseFilePath;
 	int32 CurrentPlayerID = -1;  
 	
@@ -178,11 +336,110 @@ protected:
 	bool ExecuteScalarString(const FString& Query, TFunction<void(FSQLitePreparedStatement&)> BindFunc, FString& OutValue);
 	
 	
+	bool IsInDatabaseThread() const { return !DatabaseWorker || DatabaseWorker->IsInWorkerThread(); }
+	
+	template <typename ResultType>
+	ResultType RunOnDatabaseThread(TUniqueFunction<ResultType()> Work)
+	{
+		if (!DatabaseWorker)
+		{
+			return Work();
+		}
+		return DatabaseWorker->ExecuteBlocking<ResultType>(MoveTemp(Work));
+	}
+	
+	bool UsesReadConnection() const { return ReadWorker && bReadConnectionOpen; }
+	bool IsInReadThread() const
+	{
+		return (ReadWorker && ReadWorker->IsInWorkerThread()) || (!UsesReadConnection() && IsInDatabaseThread());
+	}
+	FSQLiteDatabase* GetConnection() const { return ReadWorker && ReadWorker->IsInWorkerThread() ? ReadDatabase : Database; }
+	bool IsConnectionOpen() const { FSQLiteDatabase* Connection = GetConnection(); return Connection && Connection->IsValid(); }
+
+	template <typename ResultType>
+	ResultType RunOnReadThread(TUniqueFunction<ResultType()> Work)
+	{
+		if (!UsesReadConnection())
+		{
+			return RunOnDatabaseThread<ResultType>(MoveTemp(Work));
+		}
+		return ReadWorker->ExecuteBlocking<ResultType>(MoveTemp(Work));
+	}
+
+	template <typename ResultType>
+	void RunOnDatabaseThreadAsync(TUniqueFunction<ResultType()> Work, TUniqueFunction<void(ResultType&&)> OnComplete)
+	{
+		TUniqueFunction<void()> Task = MakeGameThreadTask<ResultType>(MoveTemp(Work), MoveTemp(OnComplete));
+
+		if (!DatabaseWorker)
+		{
+			Task();
+			return;
+		}
+		DatabaseWorker->Enqueue(MoveTemp(Task));
+	}
+
+	template <typename ResultType>
+	void RunOnReadThreadAsync(TUniqueFunction<ResultType()> Work, TUniqueFunction<void(ResultType&&)> OnComplete,
+		EDatabaseReadConsistency Consistency)
+	{
+		if (!UsesReadConnection())
+		{
+			RunOnDatabaseThreadAsync<ResultType>(MoveTemp(Work), MoveTemp(OnComplete));
+			return;
+		}
+
+		TUniqueFunction<void()> Task = MakeGameThreadTask<ResultType>(MoveTemp(Work), MoveTemp(OnComplete));
+
+		if (Consistency == EDatabaseReadConsistency::ReadYourWrites && DatabaseWorker)
+		{
+			FlushCaughtFish();
+			DatabaseWorker->Enqueue([this, Task = MoveTemp(Task)]() mutable
+			{
+				ReadWorker->Enqueue(MoveTemp(Task));
+			});
+			return;
+		}
+		ReadWorker->Enqueue(MoveTemp(Task));
+	}
+
+	template <typename ResultType>
+	TUniqueFunction<void()> MakeGameThreadTask(TUniqueFunction<ResultType()> Work, TUniqueFunction<void(ResultType&&)> OnComplete)
+	{
+		return [WeakThis = TWeakObjectPtr<UDatabaseManager>(this),
+			Work = MoveTemp(Work), OnComplete = MoveTemp(OnComplete)]() mutable
+		{
+			ResultType Result = Work();
+			AsyncTask(ENamedThreads::GameThread,
+				[WeakThis, Result = MoveTemp(Result), OnComplete = MoveTemp(OnComplete)]() mutable
+				{
+					if (WeakThis.IsValid() && OnComplete)
+					{
+						OnComplete(MoveTemp(Result));
+					}
+				});
+		};
+	}
+	
+	
+	FSQLitePreparedStatement* GetCachedStatement(const FString& Query);
+	void ClearStatementCache();
+	
+	TMap<FString, TUniquePtr<FSQLitePreparedStatement>> StatementCache;
+	TMap<FString, TUniquePtr<FSQLitePreparedStatement>> ReadStatementCache;
+	std::atomic<int64> StatementCacheHits{0};
+	std::atomic<int64> StatementCacheMisses{0};
+
+	void UpdateStorageStats();
+
+	TMap<FName, FDatabaseOperationStats> OperationStats;
+	FCriticalSection OperationStatsLock;
+	
+	
 	
 	
 	
 	
-	FString BuildPlayerIDList(const TArray<int32>& PlayerIDs) const;
 	
 	
 	bool DeletePlayerData(int32 PlayerID);
@@ -195,8 +452,58 @@ protected:
 	bool BeginTransaction();
 	bool CommitTransaction();
 	bool RollbackTransaction();
+	bool BeginSavepoint(const TCHAR* Name);
+	bool ReleaseSavepoint(const TCHAR* Name);
+	bool RollbackToSavepoint(const TCHAR* Name);
 	
 	
-	FString SerializeSpecificData(const FItemSpecificData& Data);
-	void DeserializeSpecificData(const FString& JSON, FItemSpecificData& OutData);
+	TArray<uint8> SerializeSpecificData(const FItemSpecificData& Data);
+	void DeserializeSpecificData(const TArray<uint8>& Bytes, FItemSpecificData& OutData);
+	void DeserializeLegacySpecificData(const FString& JSON, FItemSpecificData& OutData);
+	bool MigrateSpecificDataToBinary();
+
+	bool TickCatchLog(float DeltaTime);
+	bool UpsertCaughtFish(const FCaughtFishRecord& Record);
+	int32 WriteCaughtFishBatch(const TArray<FCaughtFishRecord>& Records);
+
+	TArray<FCaughtFishRecord> TakePendingCatches();
+	void RequeueCaughtFish(TArray<FCaughtFishRecord> Records);
+
+	TArray<FCaughtFishRecord> PendingCatches;
+	int32 MaxPendingCatches = 128;
+	int32 MaxQueuedCatches = 4096;
+	std::atomic<bool> bShuttingDown{false};
+	bool bCatchesSinceLastRead = false;
+	FTSTicker::FDelegateHandle CatchLogTickerHandle;
+
+	bool TickAutoBackup(float DeltaTime);
+
+	FTSTicker::FDelegateHandle AutoBackupTickerHandle;
+	TFuture<void> BackupFuture;
+	std::atomic<bool> bBackupInProgress{false};
+
+	bool BackfillSessionLeaderboard();
+	bool MigrateToItemDefinitions();
+
+	bool LoadItemDefinitions();
+	int32 FindOrCreateItemDefinition(const FString& AssetPath, const FString& Category);
+	void ForgetItemDefinitionsSince(int32 JournalIndex);
+
+	TMap<FString, int32> ItemDefinitionIDs;
+	TMap<int32, FItemDefinition> ItemDefinitions;
+
+	TArray<int32> ItemDefinitionJournal;
+	TArray<int32> SavepointJournalMarks;
+	bool bInTransaction = false;
+	
+	
+	TArray<int32> WriteSessionSnapshots(const TArray<FPlayerSaveSnapshot>& Snapshots, const TArray<FCaughtFishRecord>& Catches);
+	bool WritePlayerSnapshot(const FPlayerSaveSnapshot& Snapshot);
+	TArray<FInventoryItemRecord> BuildInventoryRecords(const FInventorySnapshot& Snapshot);
+	TMap<UItemBase*, FIntPoint> CreateItemsFromRecords(const TArray<FInventoryItemRecord>& Records, UObject* Outer);
+	bool WriteInventoryRecords(int32 PlayerID, const TArray<FInventoryItemRecord>& Records);
+	bool InsertInventoryRecords(int32 PlayerID, const TArray<FInventoryItemRecord>& Records, bool bBatched);
+	bool WriteInventoryChanges(int32 PlayerID, const TArray<FInventoryItemRecord>& ChangedRecords,
+		const TArray<FGuid>& RemovedItemGuids);
+	TArray<FInventoryItemRecord> ReadInventoryRecords(int32 PlayerID);
 };
\ No newline at end of file
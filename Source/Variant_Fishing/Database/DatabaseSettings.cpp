@@ -0,0 +1,41 @@
+#include "Variant_Fishing/Database/DatabaseSettings.h"
+
+UDatabaseSettings::UDatabaseSettings()
+{
+	SectionName = TEXT("FishingDatabase");
+}
+
+TArray<FString> UDatabaseSettings::BuildPragmas() const
+{
+	static const TCHAR* JournalModeNames[] = { TEXT("DELETE"), TEXT("TRUNCATE"), TEXT("PERSIST"), TEXT("MEMORY"), TEXT("WAL") };
+	static const TCHAR* SynchronousNames[] = { TEXT("OFF"), TEXT("NORMAL"), TEXT("FULL"), TEXT("EXTRA") };
+
+	TArray<FString> Pragmas;
+	if (bReclaimSpaceOnDelete)
+	{
+		Pragmas.Add(TEXT("PRAGMA auto_vacuum = INCREMENTAL;"));
+	}
+	Pragmas.Add(FString::Printf(TEXT("PRAGMA journal_mode = %s;"), JournalModeNames[static_cast<uint8>(JournalMode)]));
+	Pragmas.Add(FString::Printf(TEXT("PRAGMA synchronous = %s;"), SynchronousNames[static_cast<uint8>(SynchronousMode)]));
+	AddConnectionPragmas(Pragmas);
+	return Pragmas;
+}
+
+TArray<FString> UDatabaseSettings::BuildReadPragmas() const
+{
+	TArray<FString> Pragmas;
+	Pragmas.Add(TEXT("PRAGMA query_only = ON;"));
+	AddConnectionPragmas(Pragmas);
+	return Pragmas;
+}
+
+void UDatabaseSettings::AddConnectionPragmas(TArray<FString>& Pragmas) const
+{
+	Pragmas.Add(FString::Printf(TEXT("PRAGMA busy_timeout = %d;"), FMath::Max(BusyTimeoutMs, 0)));
+	if (PageCacheSizeKiB > 0)
+	{
+		Pragmas.Add(FString::Printf(TEXT("PRAGMA cache_size = -%d;"), PageCacheSizeKiB));
+	}
+	Pragmas.Add(FString::Printf(TEXT("PRAGMA mmap_size = %lld;"), static_cast<int64>(FMath::Max(MmapSizeMiB, 0)) * 1024 * 1024));
+	Pragmas.Add(bTempStoreInMemory ? TEXT("PRAGMA temp_store = MEMORY;") : TEXT("PRAGMA temp_store = DEFAULT;"));
+}
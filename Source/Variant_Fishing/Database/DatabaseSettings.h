@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "DatabaseSettings.generated.h"
+
+UENUM(BlueprintType)
+enum class EDatabaseJournalMode : uint8
+{
+	Delete UMETA(DisplayName="DELETE"),
+	Truncate UMETA(DisplayName="TRUNCATE"),
+	Persist UMETA(DisplayName="PERSIST"),
+	Memory UMETA(DisplayName="MEMORY"),
+	WAL UMETA(DisplayName="WAL")
+};
+
+UENUM(BlueprintType)
+enum class EDatabaseSynchronousMode : uint8
+{
+	Off UMETA(DisplayName="OFF"),
+	Normal UMETA(DisplayName="NORMAL"),
+	Full UMETA(DisplayName="FULL"),
+	Extra UMETA(DisplayName="EXTRA")
+};
+
+UCLASS(Config=Game, DefaultConfig, meta=(DisplayName="Fishing Database"))
+class FISHING_API UDatabaseSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UDatabaseSettings();
+
+	virtual FName GetCategoryName() const override { return TEXT("Game"); }
+
+	UPROPERTY(Config, EditAnywhere, Category = "Durability")
+	EDatabaseJournalMode JournalMode = EDatabaseJournalMode::WAL;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Durability")
+	EDatabaseSynchronousMode SynchronousMode = EDatabaseSynchronousMode::Normal;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Durability", meta = (ClampMin = "0", Units = "ms"))
+	int32 BusyTimeoutMs = 5000;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0", Units = "KiB"))
+	int32 PageCacheSizeKiB = 8192;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0", Units = "MiB"))
+	int32 MmapSizeMiB = 64;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bTempStoreInMemory = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bUseReadConnection = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Maintenance")
+	bool bReclaimSpaceOnDelete = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Maintenance", meta = (ClampMin = "1", EditCondition = "bReclaimSpaceOnDelete"))
+	int32 ReclaimPagesPerDelete = 256;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Catch Log", meta = (ClampMin = "0.1", Units = "s"))
+	float CatchLogFlushInterval = 2.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Catch Log", meta = (ClampMin = "1"))
+	int32 MaxPendingCatches = 128;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Catch Log", meta = (ClampMin = "1"))
+	int32 MaxQueuedCatches = 4096;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Backup", meta = (ClampMin = "0", Units = "min"))
+	float AutoBackupInterval = 30.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Backup", meta = (ClampMin = "1"))
+	int32 AutoBackupsToKeep = 5;
+
+	TArray<FString> BuildPragmas() const;
+	TArray<FString> BuildReadPragmas() const;
+
+private:
+	void AddConnectionPragmas(TArray<FString>& Pragmas) const;
+};
@@ -0,0 +1,118 @@
+#include "Variant_Fishing/Database/DatabaseWorker.h"
+
+#include "Fishing.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+FDatabaseWorker::FDatabaseWorker()
+{
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FDatabaseWorker::~FDatabaseWorker()
+{
+	Shutdown();
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+}
+
+bool FDatabaseWorker::Start()
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		UE_LOG(LogDatabase, Warning, TEXT("DatabaseWorker: Multithreading unsupported, running queries inline"));
+		return false;
+	}
+
+	bStopRequested = false;
+	Thread = FRunnableThread::Create(this, TEXT("DatabaseWorker"), 0, TPri_BelowNormal);
+
+	if (!Thread)
+	{
+		UE_LOG(LogDatabase, Error, TEXT("DatabaseWorker: Failed to create thread, running queries inline"));
+		return false;
+	}
+
+	UE_LOG(LogDatabase, Log, TEXT("DatabaseWorker started"));
+	return true;
+}
+
+void FDatabaseWorker::Shutdown()
+{
+	if (!Thread)
+	{
+		return;
+	}
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	TUniqueFunction<void()> Task;
+	while (TaskQueue.Dequeue(Task))
+	{
+		Task();
+	}
+
+	UE_LOG(LogDatabase, Log, TEXT("DatabaseWorker stopped"));
+}
+
+void FDatabaseWorker::Enqueue(TUniqueFunction<void()> Task)
+{
+	if (!Thread)
+	{
+		Task();
+		return;
+	}
+
+	TaskQueue.Enqueue(MoveTemp(Task));
+	WorkEvent->Trigger();
+}
+
+bool FDatabaseWorker::IsInWorkerThread() const
+{
+	return !Thread || FPlatformTLS::GetCurrentThreadId() == Thread->GetThreadID();
+}
+
+bool FDatabaseWorker::Init()
+{
+	return WorkEvent != nullptr;
+}
+
+uint32 FDatabaseWorker::Run()
+{
+	while (true)
+	{
+		TUniqueFunction<void()> Task;
+		while (TaskQueue.Dequeue(Task))
+		{
+			Task();
+		}
+
+		if (bStopRequested)
+		{
+			break;
+		}
+
+		WorkEvent->Wait();
+	}
+
+	return 0;
+}
+
+void FDatabaseWorker::Stop()
+{
+	bStopRequested = true;
+	WorkEvent->Trigger();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "Async/Future.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+class FISHING_API FDatabaseWorker : public FRunnable
+{
+public:
+	FDatabaseWorker();
+	virtual ~FDatabaseWorker() override;
+
+	bool Start();
+	void Shutdown();
+
+	void Enqueue(TUniqueFunction<void()> Task);
+
+
+	bool IsInWorkerThread() const;
+
+	template <typename ResultType>
+	ResultType ExecuteBlocking(TUniqueFunction<ResultType()> Work)
+	{
+		if (IsInWorkerThread())
+		{
+			return Work();
+		}
+
+		TPromise<ResultType> Promise;
+		TFuture<ResultType> Future = Promise.GetFuture();
+		Enqueue([&Promise, &Work]()
+		{
+			Promise.SetValue(Work());
+		});
+		return Future.Consume();
+	}
+
+
+
+
+
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> TaskQueue;
+
+	FEvent* WorkEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopRequested{false};
+};
@@ -0,0 +1,101 @@
+#include "ItemAssetSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogItemAssets, Log, All);
+
+void UItemAssetSubsystem::Deinitialize()
+{
+	LoadedAssets.Empty();
+	Super::Deinitialize();
+}
+
+UItemAssetSubsystem* UItemAssetSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UItemAssetSubsystem>() : nullptr;
+}
+
+UObject* UItemAssetSubsystem::FindLoadedAsset(const FSoftObjectPath& AssetPath)
+{
+	if (AssetPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const TObjectPtr<UObject>* Cached = LoadedAssets.Find(AssetPath))
+	{
+		return *Cached;
+	}
+
+	UObject* Asset = AssetPath.ResolveObject();
+	if (Asset)
+	{
+		LoadedAssets.Add(AssetPath, Asset);
+	}
+	return Asset;
+}
+
+UObject* UItemAssetSubsystem::LoadAssetSync(const FSoftObjectPath& AssetPath)
+{
+	if (UObject* Asset = FindLoadedAsset(AssetPath))
+	{
+		return Asset;
+	}
+
+	if (AssetPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	UObject* Asset = AssetPath.TryLoad();
+	if (Asset)
+	{
+		LoadedAssets.Add(AssetPath, Asset);
+	}
+	return Asset;
+}
+
+void UItemAssetSubsystem::LoadAssetsAsync(const TArray<FSoftObjectPath>& AssetPaths, TFunction<void()> OnLoaded)
+{
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (const FSoftObjectPath& AssetPath : AssetPaths)
+	{
+		if (!AssetPath.IsNull() && !FindLoadedAsset(AssetPath))
+		{
+			PathsToLoad.AddUnique(AssetPath);
+		}
+	}
+
+	if (PathsToLoad.Num() == 0)
+	{
+		if (OnLoaded)
+		{
+			OnLoaded();
+		}
+		return;
+	}
+
+	UE_LOG(LogItemAssets, Log, TEXT("LoadAssetsAsync: Streaming %d item assets"), PathsToLoad.Num());
+
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	StreamableManager.RequestAsyncLoad(PathsToLoad, FStreamableDelegate::CreateWeakLambda(this,
+		[this, PathsToLoad, OnLoaded = MoveTemp(OnLoaded)]()
+		{
+			for (const FSoftObjectPath& AssetPath : PathsToLoad)
+			{
+				if (!FindLoadedAsset(AssetPath))
+				{
+					UE_LOG(LogItemAssets, Warning, TEXT("LoadAssetsAsync: Failed to load %s"), *AssetPath.ToString());
+				}
+			}
+
+			if (OnLoaded)
+			{
+				OnLoaded();
+			}
+		}));
+}
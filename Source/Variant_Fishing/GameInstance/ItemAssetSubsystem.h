@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ItemAssetSubsystem.generated.h"
+
+
+UCLASS()
+class FISHING_API UItemAssetSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	static UItemAssetSubsystem* Get(const UObject* WorldContextObject);
+
+	
+	UObject* FindLoadedAsset(const FSoftObjectPath& AssetPath);
+
+	
+	UObject* LoadAssetSync(const FSoftObjectPath& AssetPath);
+
+	
+	void LoadAssetsAsync(const TArray<FSoftObjectPath>& AssetPaths, TFunction<void()> OnLoaded);
+
+private:
+	UPROPERTY()
+	TMap<FSoftObjectPath, TObjectPtr<UObject>> LoadedAssets;
+};
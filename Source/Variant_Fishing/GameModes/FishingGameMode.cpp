@@ -521,11 +521,23 @@ void AFishingGameMode::SaveGame()
 
     UE_LOG(FishingGameMode, Log, TEXT("=== SaveGame: START (Host PlayerID=%d) ==="), HostDatabasePlayerID);
 
-    
-    SavePlayerData();
+    TArray<TPair<APlayerController*, int32>> Players;
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        APlayerController* PC = It->Get();
+        if (!PC || !PC->GetPawn())
+        {
+            continue;
+        }
 
-    
-    SaveInventories();
+        const int32 PlayerID = GetOrCreateSessionPlayerID(PC);
+        if (PlayerID != -1)
+        {
+            Players.Emplace(PC, PlayerID);
+        }
+    }
+
+    SaveSession(Players);
 
     
 
@@ -724,7 +736,7 @@ void AFishingGameMode::LoadPlayerDataDelayed(APlayerController* PC, int32 Player
     UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>();
     if (Inventory)
     {
-        Inventory->LoadInventoryFromDatabase(PlayerID);
+        Inventory->LoadInventoryFromDatabase(PlayerID, true);
     }
 
     
@@ -744,112 +756,89 @@ void AFishingGameMode::SavePlayerDataForID(APlayerController* PC, int32 PlayerID
         return;
     }
 
-    AFishingCharacter* Character = Cast<AFishingCharacter>(PC->GetPawn());
-    if (!Character)
-    {
-        return;
-    }
-
-    
-    UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>();
-    if (Inventory)
-    {
-        Inventory->SaveInventoryToDatabase(PlayerID);
-    }
-
-    
-    DatabaseManager->SavePlayerMoney(PlayerID, Character->GetGold());
+    SaveSession({ TPair<APlayerController*, int32>(PC, PlayerID) });
 }
 
 
 
 
 
-void AFishingGameMode::SavePlayerData()
+void AFishingGameMode::SaveSession(const TArray<TPair<APlayerController*, int32>>& Players)
 {
     if (!DatabaseManager)
     {
+        UE_LOG(FishingGameMode, Error, TEXT("SaveSession: DatabaseManager is null!"));
         return;
     }
 
-    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
-    {
-        APlayerController* PC = It->Get();
-        if (!PC || !PC->GetPawn())
-        {
-            continue;
-        }
+    TArray<FPlayerSaveSnapshot> Snapshots;
+    TMap<int32, TWeakObjectPtr<UInventoryComponent>> Inventories;
 
-        AFishingCharacter* Character = Cast<AFishingCharacter>(PC->GetPawn());
+    for (const TPair<APlayerController*, int32>& Player : Players)
+    {
+        AFishingCharacter* Character = Player.Key ? Cast<AFishingCharacter>(Player.Key->GetPawn()) : nullptr;
         if (!Character)
         {
             continue;
         }
 
-        int32 PlayerID = GetOrCreateSessionPlayerID(PC);
-        if (PlayerID == -1)
+        FPlayerSaveSnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+        Snapshot.PlayerID = Player.Value;
+        Snapshot.TotalMoney = Character->GetGold();
+
+        UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>();
+        if (Inventory && Inventory->CaptureSaveSnapshot(Player.Value, Snapshot))
         {
-            continue;
+            Inventories.Add(Player.Value, Inventory);
         }
-
-        
-        int32 Gold = Character->GetGold();
-        DatabaseManager->SavePlayerMoney(PlayerID, Gold);
-        
-        UE_LOG(FishingGameMode, Log, TEXT("SavePlayerData: Saved Gold=%d for PlayerID=%d"), Gold, PlayerID);
     }
-}
 
-void AFishingGameMode::LoadPlayerData()
-{
-    if (!DatabaseManager)
+    if (Snapshots.Num() == 0)
     {
         return;
     }
 
-    
-    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    const int32 PlayerCount = Snapshots.Num();
+    auto OnSaved = [Inventories, PlayerCount](const TArray<int32>& FailedPlayerIDs)
     {
-        APlayerController* PC = It->Get();
-        if (!PC || !PC->GetPawn())
+        for (int32 FailedPlayerID : FailedPlayerIDs)
         {
-            continue;
+            const TWeakObjectPtr<UInventoryComponent>* Inventory = Inventories.Find(FailedPlayerID);
+            if (Inventory && Inventory->IsValid())
+            {
+                (*Inventory)->RequireFullSave();
+            }
         }
 
-        AFishingCharacter* Character = Cast<AFishingCharacter>(PC->GetPawn());
-        if (!Character)
-        {
-            continue;
-        }
+        const int32 TotalSaved = PlayerCount - FailedPlayerIDs.Num();
+        UE_LOG(FishingGameMode, Log, TEXT("=== SaveSession: Saved %d players (%d failed) ==="), TotalSaved, FailedPlayerIDs.Num());
 
-        int32 PlayerID = GetOrCreateSessionPlayerID(PC);
-        if (PlayerID == -1)
+        if (GEngine && TotalSaved > 0)
         {
-            continue;
+            GEngine->AddOnScreenDebugMessage(
+                -1, 2.0f, FColor::Green,
+                FString::Printf(TEXT("💾 Saved %d player(s)"), TotalSaved)
+            );
         }
+    };
 
-        FString PlayerName, VillageName;
-        int32 Money;
-
-        if (DatabaseManager->LoadPlayerData(PlayerID, PlayerName, VillageName, Money))
-        {
-            Character->SetGold(Money);
-            UE_LOG(FishingGameMode, Log, TEXT("LoadPlayerData: Loaded Money=%d for PlayerID=%d"), 
-                Money, PlayerID);
-        }
+    if (bAsyncSave)
+    {
+        DatabaseManager->SaveSessionAsync(MoveTemp(Snapshots), OnSaved);
+    }
+    else
+    {
+        OnSaved(DatabaseManager->SaveSession(Snapshots));
     }
 }
 
-void AFishingGameMode::SaveInventories()
+void AFishingGameMode::LoadPlayerData()
 {
     if (!DatabaseManager)
     {
-        UE_LOG(FishingGameMode, Error, TEXT("SaveInventories: DatabaseManager is null!"));
         return;
     }
 
-    int32 TotalSaved = 0;
-
     
     for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
     {
@@ -865,31 +854,22 @@ void AFishingGameMode::SaveInventories()
             continue;
         }
 
-        
         int32 PlayerID = GetOrCreateSessionPlayerID(PC);
         if (PlayerID == -1)
         {
             continue;
         }
 
-        
-        UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>();
-        if (Inventory && Inventory->SaveInventoryToDatabase(PlayerID))
+        FString PlayerName, VillageName;
+        int32 Money;
+
+        if (DatabaseManager->LoadPlayerData(PlayerID, PlayerName, VillageName, Money))
         {
-            TotalSaved++;
-            UE_LOG(FishingGameMode, Log, TEXT("✅ SaveInventories: Saved inventory for PlayerID=%d"), PlayerID);
+            Character->SetGold(Money);
+            UE_LOG(FishingGameMode, Log, TEXT("LoadPlayerData: Loaded Money=%d for PlayerID=%d"), 
+                Money, PlayerID);
         }
     }
-
-    UE_LOG(FishingGameMode, Log, TEXT("=== SaveInventories: Saved %d players ==="), TotalSaved);
-    
-    if (GEngine && TotalSaved > 0)
-    {
-        GEngine->AddOnScreenDebugMessage(
-            -1, 2.0f, FColor::Green,
-            FString::Printf(TEXT("💾 Saved %d player(s)"), TotalSaved)
-        );
-    }
 }
 
 void AFishingGameMode::LoadInventories()
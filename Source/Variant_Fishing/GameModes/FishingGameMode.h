@@ -78,6 +78,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Save|Multiplayer")
     bool bAutoSaveOnLogout = true;
 
+    
+    UPROPERTY(EditDefaultsOnly, Category = "Save")
+    bool bAsyncSave = true;
+
     UPROPERTY(EditDefaultsOnly, Category = "GameMode|Navigation")
     FText KickMessage = FText::FromString(TEXT("Host ended the session"));
 
@@ -126,10 +130,9 @@ protected:
     void AutoSave();
     
     
-    virtual void SavePlayerData();
+    virtual void SaveSession(const TArray<TPair<APlayerController*, int32>>& Players);
     virtual void LoadPlayerData();
     
-    virtual void SaveInventories();
     virtual void LoadInventories();
     
     virtual void SaveFishRecords();
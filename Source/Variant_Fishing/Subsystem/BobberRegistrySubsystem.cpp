@@ -0,0 +1,84 @@
+#include "BobberRegistrySubsystem.h"
+#include "Variant_Fishing/ActorComponent/FishingFeatures/FishingComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBobberRegistry, Log, All);
+
+UBobberRegistrySubsystem* UBobberRegistrySubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UBobberRegistrySubsystem>() : nullptr;
+}
+
+void UBobberRegistrySubsystem::RegisterBobber(UFishingComponent* Owner, UStaticMeshComponent* Bobber)
+{
+	if (!Owner || !Bobber)
+	{
+		return;
+	}
+
+	FRegisteredBobber* Entry = RegisteredBobbers.FindByPredicate([Owner](const FRegisteredBobber& Registered)
+	{
+		return Registered.Owner == Owner;
+	});
+	if (!Entry)
+	{
+		Entry = &RegisteredBobbers.AddDefaulted_GetRef();
+		Entry->Owner = Owner;
+	}
+
+	Entry->Bobber = Bobber;
+	LastRefreshFrame = MAX_uint64;
+
+	UE_LOG(LogBobberRegistry, Verbose, TEXT("Bobber registered (Registered: %d)"), RegisteredBobbers.Num());
+}
+
+void UBobberRegistrySubsystem::UnregisterBobber(UFishingComponent* Owner)
+{
+	const int32 Removed = RegisteredBobbers.RemoveAllSwap([Owner](const FRegisteredBobber& Registered)
+	{
+		return Registered.Owner == Owner;
+	});
+
+	if (Removed > 0)
+	{
+		LastRefreshFrame = MAX_uint64;
+		UE_LOG(LogBobberRegistry, Verbose, TEXT("Bobber unregistered (Registered: %d)"), RegisteredBobbers.Num());
+	}
+}
+
+const TArray<FActiveBobber>& UBobberRegistrySubsystem::GetActiveBobbers()
+{
+	if (LastRefreshFrame != GFrameCounter)
+	{
+		RefreshActiveBobbers();
+		LastRefreshFrame = GFrameCounter;
+	}
+	return ActiveBobbers;
+}
+
+void UBobberRegistrySubsystem::RefreshActiveBobbers()
+{
+	ActiveBobbers.Reset();
+
+	for (int32 i = RegisteredBobbers.Num() - 1; i >= 0; --i)
+	{
+		UFishingComponent* Owner = RegisteredBobbers[i].Owner.Get();
+		UStaticMeshComponent* Bobber = RegisteredBobbers[i].Bobber.Get();
+
+		if (!Owner || !Bobber)
+		{
+			RegisteredBobbers.RemoveAtSwap(i);
+			continue;
+		}
+
+		if (!Owner->IsFishing() || !Bobber->IsVisible())
+		{
+			continue;
+		}
+
+		FActiveBobber& Active = ActiveBobbers.AddDefaulted_GetRef();
+		Active.Bobber = Bobber;
+		Active.Location = Bobber->GetComponentLocation();
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BobberRegistrySubsystem.generated.h"
+
+class UFishingComponent;
+class UStaticMeshComponent;
+
+struct FActiveBobber
+{
+	UStaticMeshComponent* Bobber = nullptr;
+	FVector Location = FVector::ZeroVector;
+};
+
+struct FRegisteredBobber
+{
+	TWeakObjectPtr<UFishingComponent> Owner;
+	TWeakObjectPtr<UStaticMeshComponent> Bobber;
+};
+
+
+UCLASS()
+class FISHING_API UBobberRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UBobberRegistrySubsystem* Get(const UWorld* World);
+
+	void RegisterBobber(UFishingComponent* Owner, UStaticMeshComponent* Bobber);
+	void UnregisterBobber(UFishingComponent* Owner);
+
+	
+	const TArray<FActiveBobber>& GetActiveBobbers();
+
+	UFUNCTION(BlueprintPure, Category = "Fishing")
+	int32 GetRegisteredBobberCount() const { return RegisteredBobbers.Num(); }
+
+private:
+	void RefreshActiveBobbers();
+
+	TArray<FRegisteredBobber> RegisteredBobbers;
+	TArray<FActiveBobber> ActiveBobbers;
+	uint64 LastRefreshFrame = MAX_uint64;
+};
@@ -44,7 +44,7 @@ void ULeaderboardWidget::NativeConstruct()
 	CreateSortButtons();
 
 	
-	RefreshLeaderboard();
+	RefreshLeaderboardOnOpen();
 
 	UE_LOG(LogLeaderboard, Log, TEXT("NativeConstruct: End"));
 }
@@ -67,7 +67,7 @@ void ULeaderboardWidget::ToggleMenu()
 	{
 		SetVisibility(ESlateVisibility::Visible);
 		UE_LOG(LogLeaderboard, Log, TEXT("ToggleMenu: -> Visible, RefreshLeaderboard"));
-		RefreshLeaderboard();
+		RefreshLeaderboardOnOpen();
 	}
 }
 
@@ -159,6 +159,8 @@ void ULeaderboardWidget::OnSortButtonSelected(FString ButtonID)
 
 	UE_LOG(LogLeaderboard, Log, TEXT("OnSortButtonSelected: NewSort=%s"), SortTypeToString(CurrentSortType));
 
+	CurrentPage = 0;
+
 	
 	for (UCategoryFilterButton* Button : SortButtons)
 	{
@@ -172,10 +174,45 @@ void ULeaderboardWidget::OnSortButtonSelected(FString ButtonID)
 	}
 
 	
-	PopulateEntryList();
+	RefreshLeaderboard();
+}
+
+void ULeaderboardWidget::ShowNextPage()
+{
+	if ((CurrentPage + 1) * MaxEntriesToShow >= TotalRecordCount)
+	{
+		return;
+	}
+
+	++CurrentPage;
+	RefreshLeaderboard();
+}
+
+void ULeaderboardWidget::ShowPreviousPage()
+{
+	if (CurrentPage <= 0)
+	{
+		return;
+	}
+
+	--CurrentPage;
+	RefreshLeaderboard();
 }
 
 void ULeaderboardWidget::RefreshLeaderboard()
+{
+	RequestLeaderboardPage(EDatabaseReadConsistency::Snapshot);
+}
+
+void ULeaderboardWidget::RefreshLeaderboardOnOpen()
+{
+	const bool bUnreadCatches = DatabaseManager && DatabaseManager->ConsumeUnreadCatches();
+	RequestLeaderboardPage(bUnreadCatches
+		? EDatabaseReadConsistency::ReadYourWrites
+		: EDatabaseReadConsistency::Snapshot);
+}
+
+void ULeaderboardWidget::RequestLeaderboardPage(EDatabaseReadConsistency Consistency)
 {
 	UE_LOG(LogLeaderboard, Log, TEXT("RefreshLeaderboard: Begin"));
 
@@ -200,11 +237,36 @@ void ULeaderboardWidget::RefreshLeaderboard()
 		return;
 	}
 
-	UE_LOG(LogLeaderboard, Log, TEXT("RefreshLeaderboard: Using HostPlayerID=%d"), HostPlayerID);
+	const int32 Offset = CurrentPage * MaxEntriesToShow;
+	UE_LOG(LogLeaderboard, Log, TEXT("RefreshLeaderboard: Using HostPlayerID=%d, Sort=%s, Offset=%d, Limit=%d"),
+		HostPlayerID, SortTypeToString(CurrentSortType), Offset, MaxEntriesToShow);
 
 	
-	CachedEntries = DatabaseManager->GetSessionLeaderboard(HostPlayerID);
-	UE_LOG(LogLeaderboard, Log, TEXT("RefreshLeaderboard: Loaded %d entries from DB"), CachedEntries.Num());
+	TWeakObjectPtr<ULeaderboardWidget> WeakThis(this);
+	DatabaseManager->GetSessionLeaderboardPageAsync(HostPlayerID, CurrentSortType, Offset, MaxEntriesToShow,
+		[WeakThis](const TArray<FLeaderboardEntry>& Entries, int32 TotalRecords, int32 TotalPlayers)
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->OnLeaderboardLoaded(Entries, TotalRecords, TotalPlayers);
+			}
+		},
+		Consistency);
+
+	UE_LOG(LogLeaderboard, Log, TEXT("RefreshLeaderboard: Requested"));
+}
+
+void ULeaderboardWidget::OnLeaderboardLoaded(const TArray<FLeaderboardEntry>& Entries, int32 TotalRecords, int32 TotalPlayers)
+{
+	if (!DatabaseManager)
+	{
+		return;
+	}
+
+	CachedEntries = Entries;
+	TotalRecordCount = TotalRecords;
+	TotalPlayerCount = TotalPlayers;
+	UE_LOG(LogLeaderboard, Log, TEXT("OnLeaderboardLoaded: Loaded %d / %d entries from DB"), CachedEntries.Num(), TotalRecordCount);
 
 	
 	const int32 LocalPlayerID = DatabaseManager->GetActivePlayerID();
@@ -213,12 +275,10 @@ void ULeaderboardWidget::RefreshLeaderboard()
 		Entry.bIsLocalPlayer = (Entry.PlayerID == LocalPlayerID);
 	}
 
-	UE_LOG(LogLeaderboard, Verbose, TEXT("RefreshLeaderboard: LocalPlayerID=%d (Marked flags where applicable)"), LocalPlayerID);
+	UE_LOG(LogLeaderboard, Verbose, TEXT("OnLeaderboardLoaded: LocalPlayerID=%d (Marked flags where applicable)"), LocalPlayerID);
 
 	PopulateEntryList();
 	UpdateStatistics();
-
-	UE_LOG(LogLeaderboard, Log, TEXT("RefreshLeaderboard: End"));
 }
 
 AFishingGameState* ULeaderboardWidget::GetFishingGameState() const
@@ -252,26 +312,6 @@ void ULeaderboardWidget::PopulateEntryList()
 	EntryList->ClearChildren();
 
 	
-	CachedEntries.Sort([this](const FLeaderboardEntry& A, const FLeaderboardEntry& B)
-	{
-		switch (CurrentSortType)
-		{
-		case ELeaderboardSortType::BiggestLength:  return A.Length > B.Length;
-		case ELeaderboardSortType::HeaviestWeight: return A.Weight > B.Weight;
-		case ELeaderboardSortType::MostCaught:     return A.CaughtCount > B.CaughtCount;
-		default:                                    return A.Rank < B.Rank;
-		}
-	});
-	UE_LOG(LogLeaderboard, Verbose, TEXT("PopulateEntryList: Sorting done (%s)"), SortTypeToString(CurrentSortType));
-
-	
-	for (int32 i = 0; i < CachedEntries.Num(); i++)
-	{
-		CachedEntries[i].Rank = i + 1;
-	}
-	UE_LOG(LogLeaderboard, Verbose, TEXT("PopulateEntryList: Ranks re-assigned (TopRank=%d)"), CachedEntries.Num() > 0 ? CachedEntries[0].Rank : 0);
-
-	
 	const int32 Count = FMath::Min(CachedEntries.Num(), MaxEntriesToShow);
 	int32 Spawned = 0;
 	for (int32 i = 0; i < Count; i++)
@@ -310,22 +350,16 @@ void ULeaderboardWidget::UpdateStatistics()
 
 	if (TotalEntriesText)
 	{
-		TotalEntriesText->SetText(FText::FromString(FString::Printf(TEXT("Total: %d records"), CachedEntries.Num())));
+		TotalEntriesText->SetText(FText::FromString(FString::Printf(TEXT("Total: %d records"), TotalRecordCount)));
 	}
 	else
 	{
 		UE_LOG(LogLeaderboard, Warning, TEXT("UpdateStatistics: TotalEntriesText is null"));
 	}
 
-	TSet<int32> UniquePlayers;
-	for (const FLeaderboardEntry& Entry : CachedEntries)
-	{
-		UniquePlayers.Add(Entry.PlayerID);
-	}
-
 	if (TotalPlayersText)
 	{
-		TotalPlayersText->SetText(FText::FromString(FString::Printf(TEXT("%d players"), UniquePlayers.Num())));
+		TotalPlayersText->SetText(FText::FromString(FString::Printf(TEXT("%d players"), TotalPlayerCount)));
 	}
 	else
 	{
@@ -333,5 +367,5 @@ void ULeaderboardWidget::UpdateStatistics()
 	}
 
 	UE_LOG(LogLeaderboard, Log, TEXT("UpdateStatistics: Players=%d, Records=%d"),
-		UniquePlayers.Num(), CachedEntries.Num());
+		TotalPlayerCount, TotalRecordCount);
 }
@@ -12,6 +12,7 @@ class UDatabaseManager;
 class UHorizontalBox;
 class UCategoryFilterButton;
 class AFishingGameState; 
+enum class EDatabaseReadConsistency : uint8;
 
 
 UCLASS()
@@ -24,6 +25,12 @@ public:
 
     UFUNCTION(BlueprintCallable, Category = "Leaderboard")
     void RefreshLeaderboard();
+
+    UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+    void ShowNextPage();
+
+    UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+    void ShowPreviousPage();
     
     AFishingGameState* GetFishingGameState() const;
 
@@ -69,12 +76,18 @@ protected:
     UPROPERTY()
     ELeaderboardSortType CurrentSortType = ELeaderboardSortType::BiggestLength;
 
+    UPROPERTY(BlueprintReadOnly, Category = "Leaderboard")
+    int32 CurrentPage = 0;
+
 private:
     void CreateSortButtons();
 
     UFUNCTION()
     void OnSortButtonSelected(FString ButtonID);
 
+    void RequestLeaderboardPage(EDatabaseReadConsistency Consistency);
+    void RefreshLeaderboardOnOpen();
+    void OnLeaderboardLoaded(const TArray<FLeaderboardEntry>& Entries, int32 TotalRecords, int32 TotalPlayers);
     void PopulateEntryList();
     void UpdateStatistics();
 
@@ -85,4 +98,6 @@ private:
     TArray<UCategoryFilterButton*> SortButtons;
 
     TArray<FLeaderboardEntry> CachedEntries;
+    int32 TotalRecordCount = 0;
+    int32 TotalPlayerCount = 0;
 };
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "Components/WidgetSwitcher.h"
 #include "Components/ScrollBox.h"
 #include "Components/EditableTextBox.h"
+#include "Components/TextBlock.h"
+#include "Blueprint/WidgetTree.h"
 #include "SaveSlotItemWidget.h"
 #include "Kismet/GameplayStatics.h"
 #include "Fishing.h"
@@ -179,7 +181,30 @@ void UMainMenuWidget::RefreshSaveSlots()
     }
 
     
-    CachedSaveSlots = DB->GetAllSaveSlots();
+    UTextBlock* LoadingText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+    LoadingText->SetText(FText::FromString(TEXT("Loading saves...")));
+    SaveSlotList->AddChild(LoadingText);
+
+    const int32 RequestSerial = ++SaveSlotRequestSerial;
+    TWeakObjectPtr<UMainMenuWidget> WeakThis(this);
+    DB->GetAllSaveSlotsAsync([WeakThis, RequestSerial](const TArray<FSaveSlotInfo>& SaveSlots)
+    {
+        if (WeakThis.IsValid())
+        {
+            WeakThis->OnSaveSlotsLoaded(SaveSlots, RequestSerial);
+        }
+    });
+}
+
+void UMainMenuWidget::OnSaveSlotsLoaded(const TArray<FSaveSlotInfo>& SaveSlots, int32 RequestSerial)
+{
+    if (RequestSerial != SaveSlotRequestSerial || !SaveSlotList)
+    {
+        return;
+    }
+
+    SaveSlotList->ClearChildren();
+    CachedSaveSlots = SaveSlots;
 
     if (CachedSaveSlots.Num() == 0)
     {
@@ -370,7 +395,12 @@ void UMainMenuWidget::SelectSaveSlot(int32 DatabasePlayerID)
     
     FString PlayerName, VillageName;
     int32 Money;
-    if (!DB->LoadPlayerData(DatabasePlayerID, PlayerName, VillageName, Money))
+    if (const FSaveSlotInfo* SlotInfo = CachedSaveSlots.FindByPredicate(
+        [DatabasePlayerID](const FSaveSlotInfo& Info) { return Info.PlayerID == DatabasePlayerID; }))
+    {
+        PlayerName = SlotInfo->PlayerName;
+    }
+    else if (!DB->LoadPlayerData(DatabasePlayerID, PlayerName, VillageName, Money))
     {
         UE_LOG(MenuWidget, Error, TEXT("Failed to load player data for DatabasePlayerID=%d"), DatabasePlayerID);
         return;
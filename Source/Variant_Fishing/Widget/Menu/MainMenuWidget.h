@@ -154,6 +154,8 @@ protected:
     void SwitchToPanel(int32 Index);
 
 private:
+    void OnSaveSlotsLoaded(const TArray<FSaveSlotInfo>& SaveSlots, int32 RequestSerial);
     
     TArray<FSaveSlotInfo> CachedSaveSlots;
+    int32 SaveSlotRequestSerial = 0;
 };
\ No newline at end of file
@@ -48,6 +48,16 @@ void USaveSlotItemWidget::SetSaveSlotInfo(const FSaveSlotInfo& Info)
         FString TimeText = Info.LastSaveTime.IsEmpty() ? TEXT("Never") : Info.LastSaveTime;
         LastSaveTimeText->SetText(FText::FromString(TimeText));
     }
+
+    if (CatchSummaryText)
+    {
+        FString Summary = FString::Printf(TEXT("🐟 %d caught  👥 %d"), Info.TotalFishCaught, Info.GuestCount);
+        if (!Info.BestCatchName.IsEmpty())
+        {
+            Summary += FString::Printf(TEXT("  🏆 %s (%.1fcm)"), *Info.BestCatchName, Info.BestCatchLength);
+        }
+        CatchSummaryText->SetText(FText::FromString(Summary));
+    }
 }
 
 void USaveSlotItemWidget::OnLoadClicked()
@@ -45,6 +45,9 @@ protected:
 	UPROPERTY(meta = (BindWidget))
 	UTextBlock* LastSaveTimeText;
 
+	UPROPERTY(meta = (BindWidgetOptional))
+	UTextBlock* CatchSummaryText;
+
 	UPROPERTY(meta = (BindWidget))
 	UBaseButtonWidget* LoadButton;
 